@@ -0,0 +1,469 @@
+//---------------------------------------------------------------------------------
+// Benchmark.cpp
+// Author: Brent Barrese
+// Benchmark driver for the Graph class
+//---------------------------------------------------------------------------------
+// Benchmark:	Generates a synthetic graph, or reads one from a file, and times
+//				the shortest path engines of the Graph class on it.
+//
+//   --	times buildGraph, deep and shared copies, findShortestPath, single
+//		source rows for each queue strategy, and source to destination queries
+//		with Dijkstra's Algorithm, the bidirectional search, A* with landmarks
+//		and, if asked for, a contraction hierarchy
+//   --	reports the count, total time, throughput, the 50th, 90th and 99th
+//		percentile and the longest single time, and the peak memory of the
+//		process after each phase, as a table or as comma separated values
+//
+// Usage:	Benchmark [--kind sparse|dense|grid|powerlaw] [--vertices N]
+//				[--degree D] [--max-weight W] [--seed S] [--file graph.txt]
+//				[--out graph.txt] [--sources K] [--queries Q] [--copies C]
+//				[--threads T] [--strategy auto|linear|vector|heap|radix|delta|all]
+//				[--all-pairs-limit N] [--scan-limit N] [--landmarks L] [--ch]
+//				[--csv]
+//
+// Assumptions:
+//   -- peak memory is the high water mark of the whole process, so it only
+//		grows from phase to phase. run one strategy per process to compare
+//		the memory of the engines
+//   -- findShortestPath is only timed when the graph has no more than
+//		all-pairs-limit vertices, its table grows with the square of them
+//   -- the scanning strategies are only timed when the graph has no more than
+//		scan-limit vertices, each of their rows takes time square in them
+//   -- the same seed picks the same sources and queries on every run
+//   -- the sources are distinct, so no more than one per vertex are timed
+//---------------------------------------------------------------------------------
+
+
+
+#include "BenchmarkGenerators.h"
+#include "ContractionHierarchy.h"
+#include "Graph.h"
+#include "QueryWorkspace.h"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace std;
+
+// settings read from the command line
+struct Options {
+	GraphKind kind = RANDOM_SPARSE;
+	int vertices = 10000;
+	int degree = 4;
+	int maxWeight = 100;
+	uint32_t seed = 1;
+	string file;				// graph to read instead of generating one
+	string out = "benchmark_graph.txt";
+	int sources = 100;
+	int queries = 1000;
+	int copies = 3;
+	int threads = 1;
+	vector<Graph::QueueStrategy> strategies;
+	int allPairsLimit = 2000;
+	int scanLimit = 20000;
+	int landmarks = 8;
+	bool hierarchy = false;
+	bool csv = false;
+};
+
+// the times of one phase of the benchmark
+struct Measurement {
+	string phase;
+	string engine;
+	vector<double> seconds;		// one entry per timed call
+	double peakMegabytes;
+};
+
+typedef chrono::steady_clock Clock;
+
+
+//-------------------------------  peakMegabytes  ----------------------------------
+//	Returns the most memory the process has held so far
+//	Preconditions:	none
+//	Postconditions:	the peak resident size of the process in megabytes is returned,
+//					or 0 if it cannot be read
+static double peakMegabytes() {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+		return counters.PeakWorkingSetSize / 1048576.0;
+	}
+	return 0;
+#else
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) {
+		return 0;
+	}
+#ifdef __APPLE__
+	return usage.ru_maxrss / 1048576.0;
+#else
+	return usage.ru_maxrss / 1024.0;
+#endif
+#endif
+}
+
+
+//-------------------------------  secondsSince  -----------------------------------
+//	Returns the time since a moment, in seconds
+//	Preconditions:	none
+//	Postconditions:	the seconds from start to now are returned
+static double secondsSince(Clock::time_point start) {
+	return chrono::duration<double>(Clock::now() - start).count();
+}
+
+
+//-------------------------------  percentile  -------------------------------------
+//	Returns a percentile of some sorted times
+//	Preconditions:	sorted is in ascending order. fraction is between 0 and 1
+//	Postconditions:	the time that fraction of the times are no longer than is
+//					returned, 0 if there are none
+static double percentile(const vector<double>& sorted, double fraction) {
+	if (sorted.empty()) {
+		return 0;
+	}
+	size_t index = static_cast<size_t>(fraction * (sorted.size() - 1) + 0.5);
+	return sorted[index];
+}
+
+
+//--------------------------------  printReport  -----------------------------------
+//	Prints every measurement
+//	Preconditions:	none
+//	Postconditions:	one line per measurement is printed to cout, as comma separated
+//					values if csv is true and as a table otherwise. times are in
+//					milliseconds and throughput in calls per second
+static void printReport(const vector<Measurement>& measurements, bool csv) {
+	if (csv) {
+		cout << "phase,engine,count,total_ms,per_second,p50_ms,p90_ms,p99_ms,max_ms,peak_mb" << endl;
+	}
+	else {
+		cout << left << setw(14) << "phase" << setw(16) << "engine" << right
+			<< setw(8) << "count" << setw(12) << "total ms" << setw(12) << "per sec"
+			<< setw(11) << "p50 ms" << setw(11) << "p90 ms" << setw(11) << "p99 ms"
+			<< setw(11) << "max ms" << setw(10) << "peak MB" << endl;
+	}
+	for (const Measurement& measurement : measurements) {
+		vector<double> sorted = measurement.seconds;
+		sort(sorted.begin(), sorted.end());
+		double total = 0;
+		for (double seconds : sorted) {
+			total += seconds;
+		}
+		double perSecond = total > 0 ? sorted.size() / total : 0;
+		double p50 = percentile(sorted, 0.50) * 1000;
+		double p90 = percentile(sorted, 0.90) * 1000;
+		double p99 = percentile(sorted, 0.99) * 1000;
+		double longest = sorted.empty() ? 0 : sorted.back() * 1000;
+
+		if (csv) {
+			cout << measurement.phase << "," << measurement.engine << "," << sorted.size()
+				<< "," << total * 1000 << "," << perSecond << "," << p50 << "," << p90
+				<< "," << p99 << "," << longest << "," << measurement.peakMegabytes << endl;
+		}
+		else {
+			cout << left << setw(14) << measurement.phase << setw(16) << measurement.engine
+				<< right << fixed << setprecision(3) << setw(8) << sorted.size()
+				<< setw(12) << total * 1000 << setw(12) << setprecision(1) << perSecond
+				<< setprecision(4) << setw(11) << p50 << setw(11) << p90 << setw(11) << p99
+				<< setw(11) << longest << setprecision(1) << setw(10)
+				<< measurement.peakMegabytes << endl;
+			cout.unsetf(ios::fixed);
+		}
+	}
+}
+
+
+//-------------------------------  strategyName  -----------------------------------
+//	Returns the name of a queue strategy as it is given on the command line
+//	Preconditions:	none
+//	Postconditions:	the name is returned
+static string strategyName(Graph::QueueStrategy strategy) {
+	switch (strategy) {
+	case Graph::LINEAR_SCAN:	return "linear";
+	case Graph::VECTOR_SCAN:	return "vector";
+	case Graph::BINARY_HEAP:	return "heap";
+	case Graph::RADIX_HEAP:		return "radix";
+	case Graph::DELTA_STEPPING:	return "delta";
+	default:					return "auto";
+	}
+}
+
+
+//--------------------------------  parseCount  ------------------------------------
+//	Reads a count from the value of a command line flag
+//	Preconditions:	none
+//	Postconditions:	true is returned and count is set if value is a whole number
+//					from 0 to INT_MAX, otherwise false is returned and count is not
+//					changed
+static bool parseCount(const string& value, int& count) {
+	if (value.empty() || value.find_first_not_of("0123456789") != string::npos) {
+		return false;
+	}
+	errno = 0;
+	long parsed = strtol(value.c_str(), nullptr, 10);
+	if (errno == ERANGE || parsed > INT_MAX) {
+		return false;
+	}
+	count = static_cast<int>(parsed);
+	return true;
+}
+
+
+//-------------------------------  parseOptions  -----------------------------------
+//	Reads the settings from the command line
+//	Preconditions:	argv holds argc arguments
+//	Postconditions:	options holds every setting given and the default of the rest.
+//					true is returned, or false after printing the problem if an
+//					argument is not understood or a count is negative
+static bool parseOptions(int argc, char* argv[], Options& options) {
+	const Graph::QueueStrategy all[] = { Graph::AUTO_QUEUE, Graph::LINEAR_SCAN, Graph::VECTOR_SCAN,
+		Graph::BINARY_HEAP, Graph::RADIX_HEAP, Graph::DELTA_STEPPING };
+	for (int i = 1; i < argc; i++) {
+		string flag = argv[i];
+		if (flag == "--ch") {
+			options.hierarchy = true;
+			continue;
+		}
+		if (flag == "--csv") {
+			options.csv = true;
+			continue;
+		}
+		if (i + 1 >= argc) {
+			cerr << "missing value for " << flag << endl;
+			return false;
+		}
+		string value = argv[++i];
+		if (flag == "--kind") {
+			if (!parseGraphKind(value, options.kind)) {
+				cerr << "unknown graph kind " << value << endl;
+				return false;
+			}
+		}
+		else if (flag == "--strategy") {
+			bool known = false;
+			for (Graph::QueueStrategy strategy : all) {
+				if (value == "all" || value == strategyName(strategy)) {
+					options.strategies.push_back(strategy);
+					known = true;
+				}
+			}
+			if (!known) {
+				cerr << "unknown strategy " << value << endl;
+				return false;
+			}
+		}
+		else if (flag == "--file")				options.file = value;
+		else if (flag == "--out")				options.out = value;
+		else if (flag == "--vertices")			options.vertices = atoi(value.c_str());
+		else if (flag == "--degree")			options.degree = atoi(value.c_str());
+		else if (flag == "--max-weight")		options.maxWeight = atoi(value.c_str());
+		else if (flag == "--seed")				options.seed = static_cast<uint32_t>(strtoul(value.c_str(), nullptr, 10));
+		else if (flag == "--sources" || flag == "--queries") {
+			if (!parseCount(value, flag == "--sources" ? options.sources : options.queries)) {
+				cerr << flag << " must be a whole number of zero or more, not " << value << endl;
+				return false;
+			}
+		}
+		else if (flag == "--copies")			options.copies = atoi(value.c_str());
+		else if (flag == "--threads")			options.threads = atoi(value.c_str());
+		else if (flag == "--all-pairs-limit")	options.allPairsLimit = atoi(value.c_str());
+		else if (flag == "--scan-limit")		options.scanLimit = atoi(value.c_str());
+		else if (flag == "--landmarks")			options.landmarks = atoi(value.c_str());
+		else {
+			cerr << "unknown option " << flag << endl;
+			return false;
+		}
+	}
+	if (options.strategies.empty()) {
+		options.strategies.assign(begin(all), end(all));
+	}
+	if (options.vertices < 1 || options.degree < 1 || options.maxWeight < 1 ||
+		(options.kind == RANDOM_DENSE && options.degree > 100)) {
+		cerr << "vertices, degree and max-weight must be positive, and a dense degree at most 100" << endl;
+		return false;
+	}
+	return true;
+}
+
+
+//-----------------------------------  main  ---------------------------------------
+//	Runs the benchmark
+//	Preconditions:	the arguments are as listed under Usage
+//	Postconditions:	the graph is generated or read, every phase is timed and the
+//					report is printed to cout. 0 is returned, or 1 if the arguments
+//					or the graph file could not be used
+int main(int argc, char* argv[]) {
+	Options options;
+	if (!parseOptions(argc, argv, options)) {
+		return 1;
+	}
+	vector<Measurement> measurements;
+
+	// generate the graph unless one was given
+	string fileName = options.file;
+	if (fileName.empty()) {
+		fileName = options.out;
+		long long edges = 0;
+		Clock::time_point start = Clock::now();
+		if (!writeGraph(fileName, options.kind, options.vertices, options.degree,
+			options.maxWeight, options.seed, edges)) {
+			cerr << "could not write " << fileName << endl;
+			return 1;
+		}
+		measurements.push_back({ "generate", to_string(edges) + " edges", { secondsSince(start) }, peakMegabytes() });
+	}
+
+	Graph base;
+	{
+		ifstream infile(fileName);
+		if (!infile) {
+			cerr << "could not open " << fileName << endl;
+			return 1;
+		}
+		Clock::time_point start = Clock::now();
+		base.buildGraph(infile);
+		measurements.push_back({ "buildGraph", to_string(base.getEdgeCount()) + " edges", { secondsSince(start) }, peakMegabytes() });
+	}
+	base.setThreadCount(options.threads);
+	int size = base.getVertexCount();
+	if (size < 1) {
+		cerr << fileName << " holds no vertices" << endl;
+		return 1;
+	}
+
+	// copies, first with the edges copied and then with them shared
+	Measurement deepCopy = { "copy", "deep", {}, 0 };
+	Measurement sharedCopy = { "copy", "shared", {}, 0 };
+	for (int i = 0; i < options.copies; i++) {
+		base.setSharedTopology(false);
+		Clock::time_point start = Clock::now();
+		{
+			Graph copy(base);
+			deepCopy.seconds.push_back(secondsSince(start));
+		}
+		deepCopy.peakMegabytes = peakMegabytes();
+
+		base.setSharedTopology(true);
+		start = Clock::now();
+		{
+			Graph copy(base);
+			sharedCopy.seconds.push_back(secondsSince(start));
+		}
+		sharedCopy.peakMegabytes = peakMegabytes();
+	}
+	measurements.push_back(deepCopy);
+	measurements.push_back(sharedCopy);
+
+	// the same sources and queries for every engine. copies of base share its
+	// edges and start with an empty Table T
+	base.setSharedTopology(true);
+	// the row sources are distinct, a row already in Table T would be timed as
+	// a lookup
+	mt19937 random(options.seed);
+	uniform_int_distribution<int> pickVertex(1, size);
+	vector<int> sources(size);
+	for (int vertex = 1; vertex <= size; vertex++) {
+		sources[vertex - 1] = vertex;
+	}
+	shuffle(sources.begin(), sources.end(), random);
+	sources.resize(min(size, options.sources));
+	vector<Graph::PathQuery> queries(options.queries);
+	for (Graph::PathQuery& query : queries) {
+		query.source = pickVertex(random);
+		query.destination = pickVertex(random);
+	}
+
+	for (Graph::QueueStrategy strategy : options.strategies) {
+		bool scans = strategy == Graph::LINEAR_SCAN || strategy == Graph::VECTOR_SCAN;
+		if (scans && size > options.scanLimit) {
+			continue;
+		}
+		Graph engine(base);
+		engine.setQueueStrategy(strategy);
+		Measurement rows = { "row", strategyName(strategy), {}, 0 };
+		for (int source : sources) {
+			// asking for any path from source computes its whole row
+			Clock::time_point start = Clock::now();
+			engine.getPath(source, source);
+			rows.seconds.push_back(secondsSince(start));
+		}
+		rows.peakMegabytes = peakMegabytes();
+		measurements.push_back(rows);
+
+		if (size <= options.allPairsLimit) {
+			Graph allPairs(base);
+			allPairs.setQueueStrategy(strategy);
+			Clock::time_point start = Clock::now();
+			allPairs.findShortestPath();
+			measurements.push_back({ "findShortest", strategyName(strategy), { secondsSince(start) }, peakMegabytes() });
+		}
+	}
+
+	// source to destination queries, each in a workspace kept from query to query
+	QueryWorkspace workspace;
+	const Graph& graph = base;
+	Measurement forward = { "query", "dijkstra", {}, 0 };
+	Measurement both = { "query", "bidirectional", {}, 0 };
+	for (const Graph::PathQuery& query : queries) {
+		Clock::time_point start = Clock::now();
+		graph.shortestPath(query.source, query.destination, workspace);
+		forward.seconds.push_back(secondsSince(start));
+		start = Clock::now();
+		graph.shortestPath(query.source, query.destination, workspace, Graph::BIDIRECTIONAL);
+		both.seconds.push_back(secondsSince(start));
+	}
+	forward.peakMegabytes = both.peakMegabytes = peakMegabytes();
+	measurements.push_back(forward);
+	measurements.push_back(both);
+
+	if (options.landmarks > 0) {
+		Clock::time_point start = Clock::now();
+		shared_ptr<LandmarkTable> table = base.buildLandmarks(options.landmarks);
+		measurements.push_back({ "preprocess", "alt", { secondsSince(start) }, peakMegabytes() });
+		Measurement alt = { "query", "alt", {}, 0 };
+		for (const Graph::PathQuery& query : queries) {
+			start = Clock::now();
+			graph.shortestPathAStar(query.source, query.destination,
+				Graph::landmarkHeuristic(table, query.destination), workspace);
+			alt.seconds.push_back(secondsSince(start));
+		}
+		alt.peakMegabytes = peakMegabytes();
+		measurements.push_back(alt);
+	}
+
+	if (options.hierarchy) {
+		ContractionHierarchy hierarchy;
+		Clock::time_point start = Clock::now();
+		hierarchy.build(base);
+		measurements.push_back({ "preprocess", "ch", { secondsSince(start) }, peakMegabytes() });
+		Measurement ch = { "query", "ch", {}, 0 };
+		for (const Graph::PathQuery& query : queries) {
+			start = Clock::now();
+			hierarchy.shortestPath(query.source, query.destination);
+			ch.seconds.push_back(secondsSince(start));
+		}
+		ch.peakMegabytes = peakMegabytes();
+		measurements.push_back(ch);
+	}
+
+	printReport(measurements, options.csv);
+	return 0;
+}
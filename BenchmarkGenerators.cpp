@@ -0,0 +1,224 @@
+//---------------------------------------------------------------------------------
+// BenchmarkGenerators.cpp
+// Author: Brent Barrese
+// Function Definitions
+//---------------------------------------------------------------------------------
+// Graph generators:	Write synthetic graphs in the text format that
+//						Graph::buildGraph reads, for timing the shortest path
+//						engines on graphs of any size.
+//
+//   --	writes random sparse graphs, where each vertex has a fixed number of
+//		out-edges to vertices picked at random
+//   --	writes random dense graphs, where each vertex has an edge to a fixed
+//		fraction of the vertices
+//   --	writes square grids, where each vertex has an edge to and from each of
+//		its four neighbors
+//   --	writes power law graphs grown by preferential attachment, where each
+//		new vertex is tied to vertices picked in proportion to their degree
+//
+// Assumptions:
+//   -- the same kind, size, degree, weight limit and seed always write the
+//		same file
+//   -- edge weights are picked at random from 1 to maxWeight
+//   -- vertex descriptions are "Vertex " followed by the subscript
+//   -- a grid has the largest square number of vertices that is no more than
+//		the number asked for
+//---------------------------------------------------------------------------------
+
+
+
+#include "BenchmarkGenerators.h"
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <vector>
+
+
+// text is collected here and written to the file in pieces of this size
+static const size_t WRITE_CHUNK = 1 << 20;
+
+
+//--------------------------------  GraphWriter  -----------------------------------
+// Collects the lines of a graph file and writes them in large pieces
+class GraphWriter {
+public:
+	GraphWriter(ofstream& out) : out(out), edges(0) { text.reserve(WRITE_CHUNK + 64); }
+
+	// writes the vertex count and one description line per vertex
+	void writeVertices(int vertexCount) {
+		appendInt(vertexCount);
+		text += '\n';
+		for (int v = 1; v <= vertexCount; v++) {
+			text += "Vertex ";
+			appendInt(v);
+			text += '\n';
+			flushIfFull();
+		}
+	}
+
+	// writes one edge line
+	void writeEdge(int source, int destination, int weight) {
+		appendInt(source);
+		text += ' ';
+		appendInt(destination);
+		text += ' ';
+		appendInt(weight);
+		text += '\n';
+		edges++;
+		flushIfFull();
+	}
+
+	// writes the line that ends the edges and everything still collected
+	bool finish() {
+		text += "0 0 0\n";
+		out.write(text.data(), text.size());
+		text.clear();
+		return static_cast<bool>(out.flush());
+	}
+
+	// number of edge lines written
+	long long edgeCount() const { return edges; }
+
+private:
+	ofstream& out;
+	string text;
+	long long edges;
+
+	void appendInt(int value) {
+		char digits[12];
+		int length = 0;
+		do {
+			digits[length++] = static_cast<char>('0' + value % 10);
+			value /= 10;
+		} while (value > 0);
+		while (length > 0) {
+			text += digits[--length];
+		}
+	}
+
+	void flushIfFull() {
+		if (text.size() >= WRITE_CHUNK) {
+			out.write(text.data(), text.size());
+			text.clear();
+		}
+	}
+};
+
+
+//--------------------------------  writeGraph  ------------------------------------
+//	Writes a synthetic graph to a file that Graph::buildGraph can read
+//	Preconditions:	vertexCount is greater than 0. degree is greater than 0, and for
+//					RANDOM_DENSE no more than 100. maxWeight is greater than 0
+//	Postconditions:	a graph of kind with about vertexCount vertices is written to
+//					fileName, followed by the 0 0 0 line that ends it. the number
+//					of edges written is stored in edgeCount and true is returned, or
+//					false if the file could not be written
+bool writeGraph(const string& fileName, GraphKind kind, int vertexCount, int degree,
+	int maxWeight, uint32_t seed, long long& edgeCount) {
+	ofstream out(fileName, ios::binary | ios::trunc);
+	if (!out) {
+		return false;
+	}
+	GraphWriter writer(out);
+	mt19937 random(seed);
+	uniform_int_distribution<int> pickWeight(1, maxWeight);
+
+	if (kind == RANDOM_SPARSE) {
+		uniform_int_distribution<int> pickVertex(1, vertexCount);
+		writer.writeVertices(vertexCount);
+		for (int v = 1; v <= vertexCount; v++) {
+			for (int i = 0; i < degree; i++) {
+				writer.writeEdge(v, pickVertex(random), pickWeight(random));
+			}
+		}
+	}
+	else if (kind == RANDOM_DENSE) {
+		// each possible edge is kept with probability degree percent
+		uniform_int_distribution<int> pickPercent(0, 99);
+		writer.writeVertices(vertexCount);
+		for (int v = 1; v <= vertexCount; v++) {
+			for (int w = 1; w <= vertexCount; w++) {
+				if (w != v && pickPercent(random) < degree) {
+					writer.writeEdge(v, w, pickWeight(random));
+				}
+			}
+		}
+	}
+	else if (kind == GRID) {
+		int side = static_cast<int>(sqrt(static_cast<double>(vertexCount)));
+		while (static_cast<long long>(side + 1) * (side + 1) <= vertexCount) {
+			side++;
+		}
+		while (static_cast<long long>(side) * side > vertexCount) {
+			side--;
+		}
+		writer.writeVertices(side * side);
+		for (int row = 0; row < side; row++) {
+			for (int column = 0; column < side; column++) {
+				int v = row * side + column + 1;
+				if (column + 1 < side) {
+					writer.writeEdge(v, v + 1, pickWeight(random));
+					writer.writeEdge(v + 1, v, pickWeight(random));
+				}
+				if (row + 1 < side) {
+					writer.writeEdge(v, v + side, pickWeight(random));
+					writer.writeEdge(v + side, v, pickWeight(random));
+				}
+			}
+		}
+	}
+	else {
+		// ends holds both ends of every edge so far, so picking from it picks a
+		// vertex in proportion to its degree. the first degree + 1 vertices form
+		// a ring to start from
+		writer.writeVertices(vertexCount);
+		vector<int> ends;
+		ends.reserve(2 * static_cast<size_t>(degree) * vertexCount);
+		int seedVertices = degree + 1 < vertexCount ? degree + 1 : vertexCount;
+		for (int v = 1; v <= seedVertices && seedVertices > 1; v++) {
+			int next = v % seedVertices + 1;
+			writer.writeEdge(v, next, pickWeight(random));
+			writer.writeEdge(next, v, pickWeight(random));
+			ends.push_back(v);
+			ends.push_back(next);
+		}
+		for (int v = seedVertices + 1; v <= vertexCount; v++) {
+			uniform_int_distribution<size_t> pickEnd(0, ends.size() - 1);
+			for (int i = 0; i < degree; i++) {
+				int target = ends[pickEnd(random)];
+				writer.writeEdge(v, target, pickWeight(random));
+				writer.writeEdge(target, v, pickWeight(random));
+				ends.push_back(v);
+				ends.push_back(target);
+			}
+		}
+	}
+
+	edgeCount = writer.edgeCount();
+	return writer.finish();
+}
+
+
+//-------------------------------  parseGraphKind  ---------------------------------
+//	Turns the name of a kind of graph into a GraphKind
+//	Preconditions:	none
+//	Postconditions:	true is returned and kind is set if name is sparse, dense, grid or
+//					powerlaw, otherwise false is returned and kind is not changed
+bool parseGraphKind(const string& name, GraphKind& kind) {
+	if (name == "sparse") {
+		kind = RANDOM_SPARSE;
+	}
+	else if (name == "dense") {
+		kind = RANDOM_DENSE;
+	}
+	else if (name == "grid") {
+		kind = GRID;
+	}
+	else if (name == "powerlaw") {
+		kind = POWER_LAW;
+	}
+	else {
+		return false;
+	}
+	return true;
+}
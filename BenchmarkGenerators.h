@@ -0,0 +1,62 @@
+//---------------------------------------------------------------------------------
+// BenchmarkGenerators.h
+// Author: Brent Barrese
+// Function Declarations
+//---------------------------------------------------------------------------------
+// Graph generators:	Write synthetic graphs in the text format that
+//						Graph::buildGraph reads, for timing the shortest path
+//						engines on graphs of any size.
+//
+//   --	writes random sparse graphs, where each vertex has a fixed number of
+//		out-edges to vertices picked at random
+//   --	writes random dense graphs, where each vertex has an edge to a fixed
+//		fraction of the vertices
+//   --	writes square grids, where each vertex has an edge to and from each of
+//		its four neighbors
+//   --	writes power law graphs grown by preferential attachment, where each
+//		new vertex is tied to vertices picked in proportion to their degree
+//
+// Assumptions:
+//   -- the same kind, size, degree, weight limit and seed always write the
+//		same file
+//   -- edge weights are picked at random from 1 to maxWeight
+//   -- vertex descriptions are "Vertex " followed by the subscript
+//   -- a grid has the largest square number of vertices that is no more than
+//		the number asked for
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include <cstdint>
+#include <string>
+
+using namespace std;
+
+// shapes of graph the generators can write
+enum GraphKind {
+	RANDOM_SPARSE,			// degree random out-edges per vertex
+	RANDOM_DENSE,			// an edge to about degree percent of the vertices
+	GRID,					// square grid, edges both ways between neighbors
+	POWER_LAW				// preferential attachment, degree edges per new vertex
+};
+
+
+//--------------------------------  writeGraph  ------------------------------------
+//	Writes a synthetic graph to a file that Graph::buildGraph can read
+//	Preconditions:	vertexCount is greater than 0. degree is greater than 0, and for
+//					RANDOM_DENSE no more than 100. maxWeight is greater than 0
+//	Postconditions:	a graph of kind with about vertexCount vertices is written to
+//					fileName, followed by the 0 0 0 line that ends it. the number
+//					of edges written is stored in edgeCount and true is returned, or
+//					false if the file could not be written
+bool writeGraph(const string& fileName, GraphKind kind, int vertexCount, int degree,
+	int maxWeight, uint32_t seed, long long& edgeCount);
+
+
+//-------------------------------  parseGraphKind  ---------------------------------
+//	Turns the name of a kind of graph into a GraphKind
+//	Preconditions:	none
+//	Postconditions:	true is returned and kind is set if name is sparse, dense, grid or
+//					powerlaw, otherwise false is returned and kind is not changed
+bool parseGraphKind(const string& name, GraphKind& kind);
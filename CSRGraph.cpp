@@ -0,0 +1,201 @@
+//---------------------------------------------------------------------------------
+// CSRGraph.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// CSRGraph Class:	A frozen, read optimized copy of a directed, weighted graph in
+//					compressed sparse row form. The edges leaving each vertex are
+//					stored next to each other in contiguous arrays, so walking them
+//					does not follow a pointer per edge.
+//
+//   --	allows building the rows one vertex at a time, in vertex order
+//   --	allows building the reverse of another CSRGraph, with every edge turned
+//		around so each row lists the edges that arrive at a vertex
+//   --	allows finding the range of edges that leave a vertex
+//   --	allows reading the adjacent vertex and weight of an edge in that range
+//   --	allows viewing arrays that live in memory the object does not own, such
+//		as a memory mapped snapshot file, without copying them
+//
+// Assumptions:
+//   -- rows are built in order, starting with row 0
+//   -- the edges of row v are the subscripts rowBegin(v) to rowEnd(v) - 1
+//   -- the object is not changed once it is built, it is rebuilt instead
+//   -- viewed arrays stay valid for as long as the keepAlive handle passed with
+//		them is held, and copies of the object share that handle
+//   -- rows the object builds itself are never changed after they are built, so
+//		copies share them by reference count and copying costs O(1)
+//---------------------------------------------------------------------------------
+
+
+
+#include "CSRGraph.h"
+
+const int CSRGraph::NO_EDGES;
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the CSRGraph class
+//	Preconditions:	none
+//	Postconditions:	an empty CSRGraph with no rows is created
+CSRGraph::CSRGraph() {
+	clear();
+}
+
+
+//-------------------------------  copy constructor  -----------------------------
+//	Copy constructor for the CSRGraph class
+//	Preconditions:	none
+//	Postconditions:	this object holds the same rows as fromGraph. the arrays are
+//					shared with fromGraph instead of copied
+CSRGraph::CSRGraph(const CSRGraph& fromGraph) {
+	*this = fromGraph;
+}
+
+
+//---------------------------------  operator =  ---------------------------------
+//	Assignment operator for the CSRGraph class
+//	Preconditions:	none
+//	Postconditions:	this object holds the same rows as fromGraph. the arrays are
+//					shared with fromGraph instead of copied
+CSRGraph& CSRGraph::operator=(const CSRGraph& fromGraph) {
+	if (this != &fromGraph) {
+		offsetView = fromGraph.offsetView;
+		adjVertexView = fromGraph.adjVertexView;
+		weightView = fromGraph.weightView;
+		rows = fromGraph.rows;
+		keepAlive = fromGraph.keepAlive;
+		// the copy only reads the rows, building is never shared
+		building = nullptr;
+	}
+	return *this;
+}
+
+
+//---------------------------------  reset  --------------------------------------
+//	Starts building a new CSRGraph, discarding any rows already built
+//	Preconditions:	rowCount and edgeCapacity are greater than or equal to 0
+//	Postconditions:	the object is empty and has room reserved for rowCount rows
+//					and edgeCapacity edges
+void CSRGraph::reset(int rowCount, int edgeCapacity) {
+	startStorage();
+	building->offsets.reserve(rowCount + 1);
+	building->adjVertex.reserve(edgeCapacity);
+	building->weight.reserve(edgeCapacity);
+	pointAtBuilt();
+}
+
+
+//--------------------------------  addEdge  -------------------------------------
+//	Adds an edge to the row that is currently being built
+//	Preconditions:	reset has been called
+//	Postconditions:	an edge to adjVertex with the given weight is appended to the
+//					current row
+void CSRGraph::addEdge(int adjVertex, int weight) {
+	building->adjVertex.push_back(adjVertex);
+	building->weight.push_back(weight);
+	pointAtBuilt();
+}
+
+
+//---------------------------------  endRow  -------------------------------------
+//	Finishes the row that is currently being built
+//	Preconditions:	reset has been called
+//	Postconditions:	the current row is closed. the next addEdge starts a new row
+void CSRGraph::endRow() {
+	building->offsets.push_back(static_cast<int>(building->adjVertex.size()));
+	pointAtBuilt();
+}
+
+
+//-------------------------------  reverseOf  ------------------------------------
+//	Builds this object as the reverse of another CSRGraph
+//	Preconditions:	forward has been built. forward is not this object
+//	Postconditions:	this object has the same rows as forward, and row v holds an
+//					edge to u with weight w for every edge u to v with weight w in
+//					forward. edges in a row are in order of u
+void CSRGraph::reverseOf(const CSRGraph& forward) {
+	int rows = forward.rowCount();
+	int edges = forward.edgeCount();
+	startStorage();
+	vector<int>& offsets = building->offsets;
+	vector<int>& adjVertex = building->adjVertex;
+	vector<int>& weight = building->weight;
+
+	// count the edges arriving at each vertex, then turn the counts into offsets
+	offsets.assign(rows + 1, 0);
+	for (int edge = 0; edge < edges; edge++) {
+		offsets[forward.adjVertexAt(edge) + 1]++;
+	}
+	for (int v = 0; v < rows; v++) {
+		offsets[v + 1] += offsets[v];
+	}
+
+	// place each edge in the row of its adjacent vertex
+	adjVertex.assign(edges, 0);
+	weight.assign(edges, 0);
+	vector<int> next(offsets.begin(), offsets.end() - 1);
+	for (int u = 0; u < rows; u++) {
+		for (int edge = forward.rowBegin(u); edge < forward.rowEnd(u); edge++) {
+			int slot = next[forward.adjVertexAt(edge)]++;
+			adjVertex[slot] = u;
+			weight[slot] = forward.weightAt(edge);
+		}
+	}
+	pointAtBuilt();
+}
+
+
+//---------------------------------  attach  -------------------------------------
+//	Makes this object a view of arrays it does not own
+//	Preconditions:	offsets holds rowCount + 1 entries, adjVertex and weight hold
+//					offsets[rowCount] entries. keepAlive keeps the arrays valid
+//	Postconditions:	the rows of this object are read from the given arrays. any
+//					rows the object owned are released
+void CSRGraph::attach(const int* offsets, const int* adjVertex, const int* weight, int rowCount,
+	shared_ptr<const void> keepAlive) {
+	building = nullptr;
+	offsetView = offsets;
+	adjVertexView = adjVertex;
+	weightView = weight;
+	rows = rowCount;
+	this->keepAlive = keepAlive;
+}
+
+
+//---------------------------------  clear  --------------------------------------
+//	Removes every row and edge
+//	Preconditions:	none
+//	Postconditions:	the object is empty and owns no memory
+void CSRGraph::clear() {
+	building = nullptr;
+	keepAlive = nullptr;
+	offsetView = &NO_EDGES;
+	adjVertexView = nullptr;
+	weightView = nullptr;
+	rows = 0;
+}
+
+
+//-----------------------------  startStorage  -----------------------------------
+//	Starts a new, unshared storage for building rows into
+//	Preconditions:	none
+//	Postconditions:	building is a new storage with a single offset of 0, and the
+//					views point at it
+void CSRGraph::startStorage() {
+	building = make_shared<Storage>();
+	building->offsets.push_back(0);
+	keepAlive = building;
+	pointAtBuilt();
+}
+
+
+//------------------------------  pointAtBuilt  ----------------------------------
+//	Points the views at the storage being built
+//	Preconditions:	building is not nullptr
+//	Postconditions:	the views and rows match the storage being built
+void CSRGraph::pointAtBuilt() {
+	offsetView = building->offsets.data();
+	adjVertexView = building->adjVertex.data();
+	weightView = building->weight.data();
+	rows = static_cast<int>(building->offsets.size()) - 1;
+}
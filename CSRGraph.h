@@ -0,0 +1,206 @@
+//---------------------------------------------------------------------------------
+// CSRGraph.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// CSRGraph Class:	A frozen, read optimized copy of a directed, weighted graph in
+//					compressed sparse row form. The edges leaving each vertex are
+//					stored next to each other in contiguous arrays, so walking them
+//					does not follow a pointer per edge.
+//
+//   --	allows building the rows one vertex at a time, in vertex order
+//   --	allows building the reverse of another CSRGraph, with every edge turned
+//		around so each row lists the edges that arrive at a vertex
+//   --	allows finding the range of edges that leave a vertex
+//   --	allows reading the adjacent vertex and weight of an edge in that range
+//   --	allows viewing arrays that live in memory the object does not own, such
+//		as a memory mapped snapshot file, without copying them
+//
+// Assumptions:
+//   -- rows are built in order, starting with row 0
+//   -- the edges of row v are the subscripts rowBegin(v) to rowEnd(v) - 1
+//   -- the object is not changed once it is built, it is rebuilt instead
+//   -- viewed arrays stay valid for as long as the keepAlive handle passed with
+//		them is held, and copies of the object share that handle
+//   -- rows the object builds itself are never changed after they are built, so
+//		copies share them by reference count and copying costs O(1)
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+class CSRGraph {
+public:
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the CSRGraph class
+	//	Preconditions:	none
+	//	Postconditions:	an empty CSRGraph with no rows is created
+	CSRGraph();
+
+
+	//---------------------------------  reset  --------------------------------------
+	//	Starts building a new CSRGraph, discarding any rows already built
+	//	Preconditions:	rowCount and edgeCapacity are greater than or equal to 0
+	//	Postconditions:	the object is empty and has room reserved for rowCount rows
+	//					and edgeCapacity edges
+	void reset(int rowCount, int edgeCapacity);
+
+
+	//--------------------------------  addEdge  -------------------------------------
+	//	Adds an edge to the row that is currently being built
+	//	Preconditions:	reset has been called
+	//	Postconditions:	an edge to adjVertex with the given weight is appended to the
+	//					current row
+	void addEdge(int adjVertex, int weight);
+
+
+	//---------------------------------  endRow  -------------------------------------
+	//	Finishes the row that is currently being built
+	//	Preconditions:	reset has been called
+	//	Postconditions:	the current row is closed. the next addEdge starts a new row
+	void endRow();
+
+
+	//---------------------------------  clear  --------------------------------------
+	//	Removes every row and edge
+	//	Preconditions:	none
+	//	Postconditions:	the object is empty and owns no memory
+	void clear();
+
+
+	//-------------------------------  reverseOf  ------------------------------------
+	//	Builds this object as the reverse of another CSRGraph
+	//	Preconditions:	forward has been built. forward is not this object
+	//	Postconditions:	this object has the same rows as forward, and row v holds an
+	//					edge to u with weight w for every edge u to v with weight w in
+	//					forward. edges in a row are in order of u
+	void reverseOf(const CSRGraph& forward);
+
+
+	//---------------------------------  attach  -------------------------------------
+	//	Makes this object a view of arrays it does not own
+	//	Preconditions:	offsets holds rowCount + 1 entries, adjVertex and weight hold
+	//					offsets[rowCount] entries. keepAlive keeps the arrays valid
+	//	Postconditions:	the rows of this object are read from the given arrays. any
+	//					rows the object owned are released
+	void attach(const int* offsets, const int* adjVertex, const int* weight, int rowCount,
+		shared_ptr<const void> keepAlive);
+
+
+	//-------------------------------  copy constructor  -----------------------------
+	//	Copy constructor for the CSRGraph class
+	//	Preconditions:	none
+	//	Postconditions:	this object holds the same rows as fromGraph. the arrays are
+	//					shared with fromGraph instead of copied
+	CSRGraph(const CSRGraph& fromGraph);
+
+
+	//---------------------------------  operator =  ---------------------------------
+	//	Assignment operator for the CSRGraph class
+	//	Preconditions:	none
+	//	Postconditions:	this object holds the same rows as fromGraph. the arrays are
+	//					shared with fromGraph instead of copied
+	CSRGraph& operator=(const CSRGraph& fromGraph);
+
+
+	//-----------------------------  offsetArray  ------------------------------------
+	//	Returns the rowCount() + 1 row offsets, for writing the rows out
+	//	Preconditions:	none
+	//	Postconditions:	a pointer to the offsets is returned. the object is not changed
+	const int* offsetArray() const { return offsetView; }
+
+
+	//----------------------------  adjVertexArray  ----------------------------------
+	//	Returns the edgeCount() adjacent vertices, for writing the rows out
+	//	Preconditions:	none
+	//	Postconditions:	a pointer to the adjacent vertices is returned
+	const int* adjVertexArray() const { return adjVertexView; }
+
+
+	//-----------------------------  weightArray  ------------------------------------
+	//	Returns the edgeCount() weights, for writing the rows out
+	//	Preconditions:	none
+	//	Postconditions:	a pointer to the weights is returned
+	const int* weightArray() const { return weightView; }
+
+
+	//--------------------------------  rowCount  ------------------------------------
+	//	Returns the number of rows that have been built
+	//	Preconditions:	none
+	//	Postconditions:	the number of rows is returned. the object is not changed
+	int rowCount() const { return rows; }
+
+
+	//-------------------------------  edgeCount  ------------------------------------
+	//	Returns the number of edges in every row together
+	//	Preconditions:	none
+	//	Postconditions:	the number of edges is returned. the object is not changed
+	int edgeCount() const { return offsetView[rows]; }
+
+
+	//--------------------------------  rowBegin  ------------------------------------
+	//	Returns the subscript of the first edge leaving vertex
+	//	Preconditions:	vertex is in the range 0 to rowCount() - 1
+	//	Postconditions:	the subscript is returned. the object is not changed
+	int rowBegin(int vertex) const { return offsetView[vertex]; }
+
+
+	//---------------------------------  rowEnd  -------------------------------------
+	//	Returns one past the subscript of the last edge leaving vertex
+	//	Preconditions:	vertex is in the range 0 to rowCount() - 1
+	//	Postconditions:	the subscript is returned. the object is not changed
+	int rowEnd(int vertex) const { return offsetView[vertex + 1]; }
+
+
+	//------------------------------  adjVertexAt  -----------------------------------
+	//	Returns the vertex that an edge points to
+	//	Preconditions:	edge is in the range 0 to edgeCount() - 1
+	//	Postconditions:	the adjacent vertex is returned. the object is not changed
+	int adjVertexAt(int edge) const { return adjVertexView[edge]; }
+
+
+	//-------------------------------  weightAt  -------------------------------------
+	//	Returns the weight of an edge
+	//	Preconditions:	edge is in the range 0 to edgeCount() - 1
+	//	Postconditions:	the weight is returned. the object is not changed
+	int weightAt(int edge) const { return weightView[edge]; }
+
+private:
+	// arrays for rows the object builds itself
+	struct Storage {
+		vector<int> offsets;	// offsets[v] is the first edge of row v
+		vector<int> adjVertex;	// subscript of the adjacent vertex of each edge
+		vector<int> weight;		// weight of each edge
+	};
+
+	// the arrays the rows are read from, either built storage or viewed memory
+	const int* offsetView;
+	const int* adjVertexView;
+	const int* weightView;
+	int rows;					// number of rows
+
+	shared_ptr<const void> keepAlive;	// holds the arrays the views point at
+	shared_ptr<Storage> building;		// storage this object is building, not shared
+
+	static const int NO_EDGES = 0;		// offsets of an object with no rows
+
+
+	//-----------------------------  startStorage  -----------------------------------
+	//	Starts a new, unshared storage for building rows into
+	//	Preconditions:	none
+	//	Postconditions:	building is a new storage with a single offset of 0, and the
+	//					views point at it
+	void startStorage();
+
+
+	//------------------------------  pointAtBuilt  ----------------------------------
+	//	Points the views at the storage being built
+	//	Preconditions:	building is not nullptr
+	//	Postconditions:	the views and rows match the storage being built
+	void pointAtBuilt();
+};
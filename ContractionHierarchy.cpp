@@ -0,0 +1,558 @@
+//---------------------------------------------------------------------------------
+// ContractionHierarchy.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// ContractionHierarchy Class:	Preprocesses a graph read the same way as the Graph
+//								class reads it into a contraction hierarchy, and
+//								answers source to destination queries on it with two
+//								small searches that only climb the hierarchy.
+//
+//   --	allows reading a graph from a file in the buildGraph format, or taking the
+//		edges of a Graph that is already built
+//   --	orders the vertices by how few shortcuts removing them adds, removes them
+//		one at a time, and adds a shortcut edge wherever removing a vertex breaks
+//		a shortest path that no other path can stand in for
+//   --	estimates how many shortcuts a vertex needs with short witness searches
+//		of a few hops, and estimates again only for the neighbors of each vertex
+//		removed
+//   --	keeps the edges that go up the order in one compressed sparse row graph
+//		and the edges that come down the order, turned around, in another
+//   --	answers a query with an upward search from the source and an upward
+//		search from the destination along the turned around edges
+//   --	unpacks the shortcuts of a path back into the vertices of the graph, and
+//		displays it the way Graph::display does
+//
+// Assumptions:
+//   -- vertex subscripts 1 to size are used, the same as in the Graph class
+//   -- the hierarchy is not changed once it is built, it is rebuilt instead.
+//		edges inserted into or removed from the Graph later are not seen
+//   -- the length of every shortest path fits in an int, shortcuts are stored
+//		as edge weights
+//   -- the search for a path that makes a shortcut unnecessary gives up after
+//		WITNESS_SETTLE_LIMIT vertices and adds the shortcut, which costs an edge
+//		but never a wrong answer
+//   -- the order only needs to be good, not the best, so a priority is computed
+//		with PRIORITY_SETTLE_LIMIT vertices and PRIORITY_HOP_LIMIT edges per
+//		witness search and is not checked again when its vertex is removed. a
+//		vertex with more than PRIORITY_PAIR_LIMIT pairs of arcs is not searched
+//		at all, every pair is taken to need a shortcut
+//---------------------------------------------------------------------------------
+
+
+
+#include "ContractionHierarchy.h"
+#include "IndexedHeap.h"
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <iomanip>
+#include <queue>
+#include <utility>
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the ContractionHierarchy class
+//	Preconditions:	none
+//	Postconditions:	an empty hierarchy with no vertices is created
+ContractionHierarchy::ContractionHierarchy() {
+	size = 0;
+	shortcuts = 0;
+}
+
+
+//--------------------------------  buildGraph  ----------------------------------
+//	Builds a hierarchy from a graph read from an ifstream
+//	Preconditions:	infile has been successfully opened and the file contains
+//					properly formated data, as Graph::buildGraph reads it
+//	Postconditions:	one graph is read from infile, the same way Graph::buildGraph
+//					reads it, and the hierarchy is built from it
+void ContractionHierarchy::buildGraph(ifstream& infile) {
+	Graph graph;
+	graph.buildGraph(infile);
+	build(graph);
+}
+
+
+//----------------------------------  build  -------------------------------------
+//	Builds a hierarchy from the edges of a graph
+//	Preconditions:	none
+//	Postconditions:	the hierarchy holds every vertex and edge of graph, with the
+//					shortcuts the contraction needs. the descriptions of graph are
+//					shared, not copied. graph is not changed
+void ContractionHierarchy::build(Graph& graph) {
+	graph.freezeAdjacency();
+	const CSRGraph& edges = graph.adjacency;
+	size = graph.size;
+	shortcuts = 0;
+	descriptions = graph.descriptions;
+
+	outArcs.assign(size + 1, vector<Arc>());
+	inArcs.assign(size + 1, vector<Arc>());
+	contracted.assign(size + 1, false);
+	witnessDist.assign(size + 1, LLONG_MAX);
+	witnessHops.assign(size + 1, 0);
+	touched.clear();
+	witnessHeap.clear();
+	for (int v = 1; v <= size; v++) {
+		for (int edge = edges.rowBegin(v); edge < edges.rowEnd(v); edge++) {
+			if (edges.adjVertexAt(edge) != v) {
+				addArc(v, edges.adjVertexAt(edge), edges.weightAt(edge), 0);
+			}
+		}
+	}
+
+	// vertices come off the queue lowest priority first. removing a vertex only
+	// changes the priorities of its neighbors, so only theirs are computed again,
+	// and the entry a vertex had before is skipped when it comes off
+	vector<int> removedNeighbors(size + 1, 0);
+	vector<int> currentPriority(size + 1, 0);
+	priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> queue;
+	for (int v = 1; v <= size; v++) {
+		currentPriority[v] = priority(v, removedNeighbors);
+		queue.push(make_pair(currentPriority[v], v));
+	}
+	order.assign(size + 1, 0);
+	int next = 0;
+	vector<int> neighbors;
+	while (!queue.empty()) {
+		int vertex = queue.top().second;
+		int key = queue.top().first;
+		queue.pop();
+		if (contracted[vertex] || key != currentPriority[vertex]) {
+			continue;
+		}
+
+		shortcuts += contract(vertex, true, WITNESS_SETTLE_LIMIT, INT_MAX);
+		contracted[vertex] = true;
+		order[vertex] = next++;
+		detach(vertex);
+
+		neighbors.clear();
+		for (const Arc& arc : outArcs[vertex]) {
+			neighbors.push_back(arc.vertex);
+		}
+		for (const Arc& arc : inArcs[vertex]) {
+			neighbors.push_back(arc.vertex);
+		}
+		sort(neighbors.begin(), neighbors.end());
+		neighbors.erase(unique(neighbors.begin(), neighbors.end()), neighbors.end());
+		for (int neighbor : neighbors) {
+			removedNeighbors[neighbor]++;
+			currentPriority[neighbor] = priority(neighbor, removedNeighbors);
+			queue.push(make_pair(currentPriority[neighbor], neighbor));
+		}
+	}
+
+	// every arc goes up the order from one end, and only the lower end still has
+	// it: upward for its source, downward for its destination
+	int arcCount = 0;
+	for (int v = 1; v <= size; v++) {
+		arcCount += static_cast<int>(outArcs[v].size());
+	}
+	upward.reset(size + 1, arcCount);
+	downward.reset(size + 1, arcCount);
+	upwardMiddle.clear();
+	downwardMiddle.clear();
+	upward.endRow();
+	downward.endRow();
+	for (int v = 1; v <= size; v++) {
+		for (const Arc& arc : outArcs[v]) {
+			if (order[arc.vertex] > order[v]) {
+				upward.addEdge(arc.vertex, arc.weight);
+				upwardMiddle.push_back(arc.middle);
+			}
+		}
+		upward.endRow();
+		for (const Arc& arc : inArcs[v]) {
+			if (order[arc.vertex] > order[v]) {
+				downward.addEdge(arc.vertex, arc.weight);
+				downwardMiddle.push_back(arc.middle);
+			}
+		}
+		downward.endRow();
+	}
+
+	// only the two compressed graphs are needed for queries
+	outArcs.clear();
+	inArcs.clear();
+	contracted.clear();
+	witnessDist.clear();
+	witnessHops.clear();
+	targets.clear();
+	touched.clear();
+	witnessHeap.clear();
+}
+
+
+//-------------------------------  shortestPath  ---------------------------------
+//	Finds the shortest path from a source vertex to a destination vertex
+//	Preconditions:	none
+//	Postconditions:	the distance and the path, with every shortcut unpacked into
+//					the vertices of the graph, are returned along with the number
+//					of vertices both upward searches settled. if there is no path,
+//					or either vertex is not in the graph, the distance is
+//					NO_DISTANCE and the path is empty
+Graph::PathResult ContractionHierarchy::shortestPath(int source, int destination) const {
+	Graph::PathResult result;
+	result.distance = NO_DISTANCE;
+	result.settled = 0;
+	if (source < 1 || source > size || destination < 1 || destination > size) {
+		return result;
+	}
+
+	// side 0 climbs upward from source, side 1 climbs downward turned around from
+	// destination. link[v] is the vertex before v on the way up its side
+	const CSRGraph* edges[2] = { &upward, &downward };
+	vector<Distance> dist[2] = { vector<Distance>(size + 1, NO_DISTANCE),
+		vector<Distance>(size + 1, NO_DISTANCE) };
+	vector<int> link[2] = { vector<int>(size + 1, 0), vector<int>(size + 1, 0) };
+	IndexedHeap frontier[2] = { IndexedHeap(size + 1), IndexedHeap(size + 1) };
+	dist[0][source] = 0;
+	link[0][source] = source;
+	frontier[0].push(source, 0);
+	dist[1][destination] = 0;
+	link[1][destination] = destination;
+	frontier[1].push(destination, 0);
+
+	// best is the shortest joined path found so far, through vertex meet. the
+	// searches do not stop when they first meet, the top of the shortest path
+	// can be higher up, so each side stops once its frontier is past best
+	long long best = LLONG_MAX;
+	int meet = 0;
+	for (;;) {
+		bool open[2];
+		for (int side = 0; side < 2; side++) {
+			open[side] = !frontier[side].isEmpty() && frontier[side].minKey() < best;
+		}
+		if (!open[0] && !open[1]) {
+			break;
+		}
+		int side = !open[0] || (open[1] && frontier[1].minKey() < frontier[0].minKey()) ? 1 : 0;
+
+		int vertex = frontier[side].popMin();
+		result.settled++;
+		if (dist[1 - side][vertex] < NO_DISTANCE &&
+			static_cast<long long>(dist[side][vertex]) + dist[1 - side][vertex] < best) {
+			best = static_cast<long long>(dist[side][vertex]) + dist[1 - side][vertex];
+			meet = vertex;
+		}
+
+		const CSRGraph& row = *edges[side];
+		for (int edge = row.rowBegin(vertex); edge < row.rowEnd(vertex); edge++) {
+			int adjacent = row.adjVertexAt(edge);
+			Distance newDist = dist[side][vertex] + row.weightAt(edge);
+			if (dist[side][adjacent] > newDist) {
+				dist[side][adjacent] = newDist;
+				link[side][adjacent] = vertex;
+				if (frontier[side].contains(adjacent)) {
+					frontier[side].decreaseKey(adjacent, newDist);
+				}
+				else {
+					frontier[side].push(adjacent, newDist);
+				}
+			}
+		}
+	}
+	if (meet == 0) {
+		return result;
+	}
+	result.distance = static_cast<Distance>(best);
+
+	// the edges of the path through the hierarchy, in order of travel
+	vector<pair<int, int>> climb;
+	for (int vertex = meet; vertex != source; vertex = link[0][vertex]) {
+		climb.push_back(make_pair(link[0][vertex], vertex));
+	}
+	reverse(climb.begin(), climb.end());
+	for (int vertex = meet; vertex != destination; vertex = link[1][vertex]) {
+		climb.push_back(make_pair(vertex, link[1][vertex]));
+	}
+
+	// unpack each shortcut into the two edges it skips, without recursion. the
+	// stack holds the edges still to unpack, the next one in travel order on top
+	result.path.push_back(source);
+	vector<pair<int, int>> pending(climb.rbegin(), climb.rend());
+	while (!pending.empty()) {
+		pair<int, int> edge = pending.back();
+		pending.pop_back();
+		int middle = findMiddle(edge.first, edge.second);
+		if (middle == 0) {
+			result.path.push_back(edge.second);
+		}
+		else {
+			pending.push_back(make_pair(middle, edge.second));
+			pending.push_back(make_pair(edge.first, middle));
+		}
+	}
+	return result;
+}
+
+
+//---------------------------------  display  ------------------------------------
+//	Displays a single, detailed path from a source vertex to a destination vertex
+//	Preconditions:	none
+//	Postconditions:	the source vertex, destination vertex, distance and path are
+//					printed on one line and the description of each vertex of the
+//					path on the lines after it, laid out as Graph::display lays
+//					them out. nothing is printed if either vertex is not a vertex
+void ContractionHierarchy::display(int source, int destination) const {
+	if (source < 1 || source > size || destination < 1 || destination > size) {
+		return;
+	}
+	Graph::PathResult result = shortestPath(source, destination);
+
+	cout << source;
+	cout << setw(6) << destination;
+	if (result.distance < NO_DISTANCE) {
+		cout << setw(6) << result.distance;
+	}
+	else {
+		cout << setw(6) << "--";
+	}
+
+	cout << setw(6);
+	for (int vertex : result.path) {
+		cout << " " << vertex;
+	}
+	cout << endl;
+	for (int vertex : result.path) {
+		cout << descriptions->description(vertex) << endl;
+	}
+}
+
+
+//-------------------------------  vertexCount  ----------------------------------
+//	Returns the number of vertices in the hierarchy
+//	Preconditions:	none
+//	Postconditions:	the number of vertices is returned. object is not changed
+int ContractionHierarchy::vertexCount() const {
+	return size;
+}
+
+
+//------------------------------  shortcutCount  ---------------------------------
+//	Returns the number of shortcut edges the contraction added
+//	Preconditions:	none
+//	Postconditions:	the number of shortcuts is returned. object is not changed
+int ContractionHierarchy::shortcutCount() const {
+	return shortcuts;
+}
+
+
+//-----------------------------------  rank  -------------------------------------
+//	Returns the position of a vertex in the contraction order
+//	Preconditions:	vertex is in the range 1 to vertexCount()
+//	Postconditions:	0 is returned for the vertex removed first, vertexCount() - 1
+//					for the vertex removed last
+int ContractionHierarchy::rank(int vertex) const {
+	return order[vertex];
+}
+
+
+//--------------------------------  contract  ------------------------------------
+//	Finds the shortcuts removing a vertex needs, and adds them if asked to
+//	Preconditions:	vertex has not been contracted
+//	Postconditions:	the number of shortcuts removing vertex needs is returned,
+//					found with witness searches of at most settleLimit vertices and
+//					hopLimit edges. if addShortcuts is true they are added to
+//					outArcs and inArcs
+int ContractionHierarchy::contract(int vertex, bool addShortcuts, int settleLimit, int hopLimit) {
+	// every arc of vertex leads to a vertex still in the graph
+	targets.clear();
+	for (const Arc& out : outArcs[vertex]) {
+		targets.push_back(make_pair(out.weight, out.vertex));
+	}
+	sort(targets.begin(), targets.end(), greater<pair<int, int>>());
+
+	int needed = 0;
+	for (size_t i = 0; i < inArcs[vertex].size(); i++) {
+		// copied, adding a shortcut can grow the arrays of other vertices
+		Arc in = inArcs[vertex][i];
+
+		witnessSearch(in.vertex, vertex, in.weight, settleLimit, hopLimit);
+		for (size_t j = 0; j < outArcs[vertex].size(); j++) {
+			Arc out = outArcs[vertex][j];
+			if (out.vertex == in.vertex) {
+				continue;
+			}
+			// another path at least as short makes the shortcut unnecessary
+			long long through = static_cast<long long>(in.weight) + out.weight;
+			if (witnessDist[out.vertex] <= through) {
+				continue;
+			}
+			needed++;
+			if (addShortcuts) {
+				addArc(in.vertex, out.vertex, static_cast<int>(through), vertex);
+			}
+		}
+		for (int reached : touched) {
+			witnessDist[reached] = LLONG_MAX;
+		}
+		touched.clear();
+	}
+
+	return needed;
+}
+
+
+//--------------------------------  priority  ------------------------------------
+//	Estimates how attractive removing a vertex next is, lower first
+//	Preconditions:	vertex has not been contracted
+//	Postconditions:	the shortcuts vertex needs as short witness searches find
+//					them, less the edges removing it takes away, plus the number
+//					of its neighbors already removed, is returned
+int ContractionHierarchy::priority(int vertex, const vector<int>& removedNeighbors) {
+	int removed = static_cast<int>(outArcs[vertex].size() + inArcs[vertex].size());
+
+	// a vertex with many arcs is removed late either way, searching around it
+	// would cost more than the order gains
+	long long pairs = static_cast<long long>(outArcs[vertex].size()) * inArcs[vertex].size();
+	int needed = pairs > PRIORITY_PAIR_LIMIT ? static_cast<int>(min(pairs, static_cast<long long>(INT_MAX / 2)))
+		: contract(vertex, false, PRIORITY_SETTLE_LIMIT, PRIORITY_HOP_LIMIT);
+	return needed - removed + removedNeighbors[vertex];
+}
+
+
+//---------------------------------  detach  -------------------------------------
+//	Takes the arcs leading to a vertex that was just removed out of its neighbors
+//	Preconditions:	vertex has just been contracted
+//	Postconditions:	no vertex still in the graph has an arc to or from vertex. the
+//					arcs of vertex itself are not changed
+void ContractionHierarchy::detach(int vertex) {
+	// the order of the arcs of a vertex does not matter, so each one is taken out
+	// by moving the last arc into its place
+	auto remove = [vertex](vector<Arc>& arcs) {
+		for (size_t i = 0; i < arcs.size(); i++) {
+			if (arcs[i].vertex == vertex) {
+				arcs[i] = arcs.back();
+				arcs.pop_back();
+				return;
+			}
+		}
+	};
+	for (const Arc& out : outArcs[vertex]) {
+		remove(inArcs[out.vertex]);
+	}
+	for (const Arc& in : inArcs[vertex]) {
+		remove(outArcs[in.vertex]);
+	}
+}
+
+
+//------------------------------  witnessSearch  ---------------------------------
+//	Finds the distances from a vertex without passing through another vertex
+//	Preconditions:	witnessDist is LLONG_MAX everywhere and touched is empty.
+//					targets holds the arcs out of avoid
+//	Postconditions:	witnessDist holds distances from source, found without going
+//					through avoid, settling at most settleLimit vertices and
+//					following at most hopLimit edges. the search stops once each
+//					vertex of targets other than source either has a path no longer
+//					than inWeight plus the weight of its arc, or can no longer get
+//					one. touched lists each vertex whose witnessDist was set
+void ContractionHierarchy::witnessSearch(int source, int avoid, long long inWeight, int settleLimit,
+	int hopLimit) {
+	// the heap holds negated distances, so the top of the max heap is the nearest
+	witnessHeap.clear();
+	witnessDist[source] = 0;
+	witnessHops[source] = 0;
+	touched.push_back(source);
+	witnessHeap.push_back(make_pair(0LL, source));
+
+	// targets before open have a path or are source. the search is done once the
+	// nearest vertex left is farther than the heaviest target that has none
+	size_t open = 0;
+	auto openBound = [&]() {
+		while (open < targets.size() && (targets[open].second == source ||
+			witnessDist[targets[open].second] <= inWeight + targets[open].first)) {
+			open++;
+		}
+		return open < targets.size() ? inWeight + targets[open].first : -1;
+	};
+
+	int settled = 0;
+	while (!witnessHeap.empty() && settled < settleLimit) {
+		pop_heap(witnessHeap.begin(), witnessHeap.end());
+		long long dist = -witnessHeap.back().first;
+		int vertex = witnessHeap.back().second;
+		witnessHeap.pop_back();
+		// an entry left behind when a shorter distance was found later
+		if (dist > witnessDist[vertex]) {
+			continue;
+		}
+		if (dist > openBound()) {
+			break;
+		}
+		settled++;
+		if (witnessHops[vertex] >= hopLimit) {
+			continue;
+		}
+		for (const Arc& arc : outArcs[vertex]) {
+			if (arc.vertex == avoid) {
+				continue;
+			}
+			long long newDist = dist + arc.weight;
+			long long oldDist = witnessDist[arc.vertex];
+			if (newDist < oldDist) {
+				if (oldDist == LLONG_MAX) {
+					touched.push_back(arc.vertex);
+				}
+				witnessDist[arc.vertex] = newDist;
+				witnessHops[arc.vertex] = witnessHops[vertex] + 1;
+				witnessHeap.push_back(make_pair(-newDist, arc.vertex));
+				push_heap(witnessHeap.begin(), witnessHeap.end());
+			}
+		}
+	}
+}
+
+
+//---------------------------------  addArc  -------------------------------------
+//	Adds an edge or shortcut between two vertices still in the graph
+//	Preconditions:	from and to are different vertices
+//	Postconditions:	outArcs of from and inArcs of to hold the arc. an arc that is
+//					already there keeps the lower weight of the two
+void ContractionHierarchy::addArc(int from, int to, int weight, int middle) {
+	for (Arc& out : outArcs[from]) {
+		if (out.vertex == to) {
+			if (weight < out.weight) {
+				out.weight = weight;
+				out.middle = middle;
+				for (Arc& in : inArcs[to]) {
+					if (in.vertex == from) {
+						in.weight = weight;
+						in.middle = middle;
+					}
+				}
+			}
+			return;
+		}
+	}
+	outArcs[from].push_back(Arc{ to, weight, middle });
+	inArcs[to].push_back(Arc{ from, weight, middle });
+}
+
+
+//--------------------------------  findMiddle  ----------------------------------
+//	Finds the vertex the edge between two vertices skips
+//	Preconditions:	the hierarchy has an edge from from to to
+//	Postconditions:	the middle vertex of the edge is returned, 0 if it is an edge
+//					of the graph
+int ContractionHierarchy::findMiddle(int from, int to) const {
+	// the edge is kept in the row of whichever end is lower in the order
+	if (order[to] > order[from]) {
+		for (int edge = upward.rowBegin(from); edge < upward.rowEnd(from); edge++) {
+			if (upward.adjVertexAt(edge) == to) {
+				return upwardMiddle[edge];
+			}
+		}
+	}
+	else {
+		for (int edge = downward.rowBegin(to); edge < downward.rowEnd(to); edge++) {
+			if (downward.adjVertexAt(edge) == from) {
+				return downwardMiddle[edge];
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,223 @@
+//---------------------------------------------------------------------------------
+// ContractionHierarchy.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// ContractionHierarchy Class:	Preprocesses a graph read the same way as the Graph
+//								class reads it into a contraction hierarchy, and
+//								answers source to destination queries on it with two
+//								small searches that only climb the hierarchy.
+//
+//   --	allows reading a graph from a file in the buildGraph format, or taking the
+//		edges of a Graph that is already built
+//   --	orders the vertices by how few shortcuts removing them adds, removes them
+//		one at a time, and adds a shortcut edge wherever removing a vertex breaks
+//		a shortest path that no other path can stand in for
+//   --	estimates how many shortcuts a vertex needs with short witness searches
+//		of a few hops, and estimates again only for the neighbors of each vertex
+//		removed
+//   --	keeps the edges that go up the order in one compressed sparse row graph
+//		and the edges that come down the order, turned around, in another
+//   --	answers a query with an upward search from the source and an upward
+//		search from the destination along the turned around edges
+//   --	unpacks the shortcuts of a path back into the vertices of the graph, and
+//		displays it the way Graph::display does
+//
+// Assumptions:
+//   -- vertex subscripts 1 to size are used, the same as in the Graph class
+//   -- the hierarchy is not changed once it is built, it is rebuilt instead.
+//		edges inserted into or removed from the Graph later are not seen
+//   -- the length of every shortest path fits in an int, shortcuts are stored
+//		as edge weights
+//   -- the search for a path that makes a shortcut unnecessary gives up after
+//		WITNESS_SETTLE_LIMIT vertices and adds the shortcut, which costs an edge
+//		but never a wrong answer
+//   -- the order only needs to be good, not the best, so a priority is computed
+//		with PRIORITY_SETTLE_LIMIT vertices and PRIORITY_HOP_LIMIT edges per
+//		witness search and is not checked again when its vertex is removed. a
+//		vertex with more than PRIORITY_PAIR_LIMIT pairs of arcs is not searched
+//		at all, every pair is taken to need a shortcut
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "Graph.h"
+#include "CSRGraph.h"
+#include "Distance.h"
+#include "DescriptionArena.h"
+#include <fstream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+class ContractionHierarchy {
+public:
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the ContractionHierarchy class
+	//	Preconditions:	none
+	//	Postconditions:	an empty hierarchy with no vertices is created
+	ContractionHierarchy();
+
+
+	//--------------------------------  buildGraph  ----------------------------------
+	//	Builds a hierarchy from a graph read from an ifstream
+	//	Preconditions:	infile has been successfully opened and the file contains
+	//					properly formated data, as Graph::buildGraph reads it
+	//	Postconditions:	one graph is read from infile, the same way Graph::buildGraph
+	//					reads it, and the hierarchy is built from it
+	void buildGraph(ifstream& infile);
+
+
+	//----------------------------------  build  -------------------------------------
+	//	Builds a hierarchy from the edges of a graph
+	//	Preconditions:	none
+	//	Postconditions:	the hierarchy holds every vertex and edge of graph, with the
+	//					shortcuts the contraction needs. the descriptions of graph are
+	//					shared, not copied. graph is not changed
+	void build(Graph& graph);
+
+
+	//-------------------------------  shortestPath  ---------------------------------
+	//	Finds the shortest path from a source vertex to a destination vertex
+	//	Preconditions:	none
+	//	Postconditions:	the distance and the path, with every shortcut unpacked into
+	//					the vertices of the graph, are returned along with the number
+	//					of vertices both upward searches settled. if there is no path,
+	//					or either vertex is not in the graph, the distance is
+	//					NO_DISTANCE and the path is empty
+	Graph::PathResult shortestPath(int source, int destination) const;
+
+
+	//---------------------------------  display  ------------------------------------
+	//	Displays a single, detailed path from a source vertex to a destination vertex
+	//	Preconditions:	none
+	//	Postconditions:	the source vertex, destination vertex, distance and path are
+	//					printed on one line and the description of each vertex of the
+	//					path on the lines after it, laid out as Graph::display lays
+	//					them out. nothing is printed if either vertex is not a vertex
+	void display(int source, int destination) const;
+
+
+	//-------------------------------  vertexCount  ----------------------------------
+	//	Returns the number of vertices in the hierarchy
+	//	Preconditions:	none
+	//	Postconditions:	the number of vertices is returned. object is not changed
+	int vertexCount() const;
+
+
+	//------------------------------  shortcutCount  ---------------------------------
+	//	Returns the number of shortcut edges the contraction added
+	//	Preconditions:	none
+	//	Postconditions:	the number of shortcuts is returned. object is not changed
+	int shortcutCount() const;
+
+
+	//-----------------------------------  rank  -------------------------------------
+	//	Returns the position of a vertex in the contraction order
+	//	Preconditions:	vertex is in the range 1 to vertexCount()
+	//	Postconditions:	0 is returned for the vertex removed first, vertexCount() - 1
+	//					for the vertex removed last
+	int rank(int vertex) const;
+
+private:
+	// one edge between vertices still in the graph while it is being contracted
+	struct Arc {
+		int vertex;				// subscript of the vertex at the other end
+		int weight;				// weight of the edge or shortcut
+		int middle;				// vertex the shortcut skips, 0 for an edge of the graph
+	};
+
+	static const int WITNESS_SETTLE_LIMIT = 500;
+	static const int PRIORITY_SETTLE_LIMIT = 20;
+	static const int PRIORITY_HOP_LIMIT = 2;
+	static const int PRIORITY_PAIR_LIMIT = 100;
+
+	int size;					// number of vertices
+	int shortcuts;				// number of shortcuts added
+	vector<int> order;			// order[v] is the rank of vertex v
+	shared_ptr<const DescriptionArena> descriptions;	// shared with the Graph built from
+
+	// edges from a vertex to a vertex of higher rank, and the edges arriving at a
+	// vertex from a vertex of higher rank turned around. the middle vertex of each
+	// edge is kept in the same order as the edges, 0 for an edge of the graph
+	CSRGraph upward;
+	CSRGraph downward;
+	vector<int> upwardMiddle;
+	vector<int> downwardMiddle;
+
+	// state used only while contracting. the arcs of a vertex still in the graph
+	// only lead to vertices still in the graph. once a vertex is removed its own
+	// arcs are kept, they become its rows of upward and downward, and the arcs
+	// leading back to it are taken out of its neighbors
+	vector<vector<Arc>> outArcs;
+	vector<vector<Arc>> inArcs;
+	vector<bool> contracted;
+
+	// witness search state, kept from one search to the next. witnessDist is only
+	// set for the vertices in touched
+	vector<long long> witnessDist;
+	vector<int> witnessHops;
+	vector<pair<int, int>> targets;	// weight and vertex of each arc out of the vertex being
+									// removed, heaviest first
+	vector<int> touched;
+	vector<pair<long long, int>> witnessHeap;
+
+
+	//--------------------------------  contract  ------------------------------------
+	//	Finds the shortcuts removing a vertex needs, and adds them if asked to
+	//	Preconditions:	vertex has not been contracted
+	//	Postconditions:	the number of shortcuts removing vertex needs is returned,
+	//					found with witness searches of at most settleLimit vertices and
+	//					hopLimit edges. if addShortcuts is true they are added to
+	//					outArcs and inArcs
+	int contract(int vertex, bool addShortcuts, int settleLimit, int hopLimit);
+
+
+	//--------------------------------  priority  ------------------------------------
+	//	Estimates how attractive removing a vertex next is, lower first
+	//	Preconditions:	vertex has not been contracted
+	//	Postconditions:	the shortcuts vertex needs as short witness searches find
+	//					them, less the edges removing it takes away, plus the number
+	//					of its neighbors already removed, is returned
+	int priority(int vertex, const vector<int>& removedNeighbors);
+
+
+	//---------------------------------  detach  -------------------------------------
+	//	Takes the arcs leading to a vertex that was just removed out of its neighbors
+	//	Preconditions:	vertex has just been contracted
+	//	Postconditions:	no vertex still in the graph has an arc to or from vertex. the
+	//					arcs of vertex itself are not changed
+	void detach(int vertex);
+
+
+	//------------------------------  witnessSearch  ---------------------------------
+	//	Finds the distances from a vertex without passing through another vertex
+	//	Preconditions:	witnessDist is LLONG_MAX everywhere and touched is empty.
+	//					targets holds the arcs out of avoid
+	//	Postconditions:	witnessDist holds distances from source, found without going
+	//					through avoid, settling at most settleLimit vertices and
+	//					following at most hopLimit edges. the search stops once each
+	//					vertex of targets other than source either has a path no longer
+	//					than inWeight plus the weight of its arc, or can no longer get
+	//					one. touched lists each vertex whose witnessDist was set
+	void witnessSearch(int source, int avoid, long long inWeight, int settleLimit, int hopLimit);
+
+
+	//---------------------------------  addArc  -------------------------------------
+	//	Adds an edge or shortcut between two vertices still in the graph
+	//	Preconditions:	from and to are different vertices
+	//	Postconditions:	outArcs of from and inArcs of to hold the arc. an arc that is
+	//					already there keeps the lower weight of the two
+	void addArc(int from, int to, int weight, int middle);
+
+
+	//--------------------------------  findMiddle  ----------------------------------
+	//	Finds the vertex the edge between two vertices skips
+	//	Preconditions:	the hierarchy has an edge from from to to
+	//	Postconditions:	the middle vertex of the edge is returned, 0 if it is an edge
+	//					of the graph
+	int findMiddle(int from, int to) const;
+};
@@ -0,0 +1,190 @@
+//---------------------------------------------------------------------------------
+// DescriptionArena.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// DescriptionArena Class:	The descriptions of the vertices of a graph, kept end
+//							to end in one block of characters with an offset per
+//							description, and a hash index from each description
+//							back to its subscript.
+//
+//   --	allows reading descriptions one line at a time straight into the block,
+//		with no allocation per description
+//   --	allows adding a description from characters the caller holds
+//   --	allows viewing a block and offsets that live in memory the object does
+//		not own, such as a memory mapped snapshot file, without copying them
+//   --	allows reading a description as a view of the block
+//   --	allows finding the subscript of a description through an open addressing
+//		hash table of subscripts, once the index is built
+//
+// Assumptions:
+//   -- description i is the characters offsets[i] to offsets[i + 1] - 1
+//   -- descriptions are only added before the index is built, the finished
+//		object is not changed and is shared by the graphs that use it
+//   -- when two descriptions are the same, find returns the lower subscript
+//   -- viewed memory stays valid for as long as the keepAlive handle passed
+//		with it is held
+//---------------------------------------------------------------------------------
+
+
+
+#include "DescriptionArena.h"
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the DescriptionArena class
+//	Preconditions:	none
+//	Postconditions:	an empty arena with no descriptions is created
+DescriptionArena::DescriptionArena() : offsets(1, 0) {
+	refreshViews();
+}
+
+
+//--------------------------------  reserve  -------------------------------------
+//	Makes room for descriptions that are about to be added
+//	Preconditions:	count and characters are greater than or equal to 0
+//	Postconditions:	count more descriptions of characters characters in all can
+//					be added without the block growing
+void DescriptionArena::reserve(int count, size_t characters) {
+	offsets.reserve(offsets.size() + count);
+	text.reserve(text.size() + characters);
+	refreshViews();
+}
+
+
+//----------------------------------  add  ---------------------------------------
+//	Adds a description from characters the caller holds
+//	Preconditions:	the arena is not a view. text holds length characters
+//	Postconditions:	a copy of the characters is appended to the block as the next
+//					description, and its subscript is returned
+int DescriptionArena::add(const char* text, size_t length) {
+	this->text.append(text, length);
+	offsets.push_back(static_cast<int64_t>(this->text.size()));
+	refreshViews();
+	return entries - 1;
+}
+
+
+//--------------------------------  readLine  ------------------------------------
+//	Reads the next description from a stream, the way getline reads a line
+//	Preconditions:	the arena is not a view
+//	Postconditions:	the characters up to the next '\n' are appended to the block as
+//					the next description, and the '\n' is thrown away. at the end of
+//					the stream eofbit is set, and failbit too if nothing was read.
+//					the subscript of the description is returned
+int DescriptionArena::readLine(istream& in) {
+	// a stream that has already failed gives an empty description, as getline does
+	if (!in.good()) {
+		in.setstate(ios::failbit);
+	}
+	else {
+		streambuf& buffer = *in.rdbuf();
+		const int end = char_traits<char>::eof();
+		bool extracted = false;
+		int c = buffer.sbumpc();
+		while (c != end && c != '\n') {
+			text += static_cast<char>(c);
+			extracted = true;
+			c = buffer.sbumpc();
+		}
+		if (c == end) {
+			in.setstate(extracted ? ios::eofbit : ios::eofbit | ios::failbit);
+		}
+	}
+	offsets.push_back(static_cast<int64_t>(text.size()));
+	refreshViews();
+	return entries - 1;
+}
+
+
+//--------------------------------  attach  --------------------------------------
+//	Makes this object a view of descriptions it does not own
+//	Preconditions:	offsets holds count + 1 entries, text holds offsets[count]
+//					characters. keepAlive keeps them valid
+//	Postconditions:	the descriptions of this object are read from the given memory.
+//					anything the object held before is released
+void DescriptionArena::attach(const int64_t* offsets, const char* text, int count,
+	shared_ptr<const void> keepAlive) {
+	vector<int64_t>().swap(this->offsets);
+	string().swap(this->text);
+	vector<int>().swap(slots);
+	offsetView = offsets;
+	textView = text;
+	entries = count;
+	this->keepAlive = move(keepAlive);
+}
+
+
+//-------------------------------  buildIndex  -----------------------------------
+//	Builds the hash index that find reads
+//	Preconditions:	first is greater than or equal to 0
+//	Postconditions:	every description from subscript first on can be found. the
+//					table has at least twice as many slots as descriptions, so a
+//					lookup reads only a few slots
+void DescriptionArena::buildIndex(int first) {
+	size_t indexed = entries > first ? static_cast<size_t>(entries - first) : 0;
+	size_t slotCount = 1;
+	while (slotCount < 2 * indexed) {
+		slotCount *= 2;
+	}
+	slots.assign(slotCount, -1);
+	size_t mask = slotCount - 1;
+	for (int entry = first; entry < entries; entry++) {
+		string_view key = description(entry);
+		// linear probing. a description already in the table keeps its slot, so
+		// the lower subscript is the one found
+		for (size_t slot = hash(key) & mask; ; slot = (slot + 1) & mask) {
+			if (slots[slot] < 0) {
+				slots[slot] = entry;
+				break;
+			}
+			if (description(slots[slot]) == key) {
+				break;
+			}
+		}
+	}
+}
+
+
+//---------------------------------  find  ---------------------------------------
+//	Finds the subscript of a description
+//	Preconditions:	buildIndex has been called
+//	Postconditions:	the lowest indexed subscript whose description is the same as
+//					description is returned, or -1 if there is none
+int DescriptionArena::find(string_view description) const {
+	if (slots.empty()) {
+		return -1;
+	}
+	size_t mask = slots.size() - 1;
+	for (size_t slot = hash(description) & mask; slots[slot] >= 0; slot = (slot + 1) & mask) {
+		if (this->description(slots[slot]) == description) {
+			return slots[slot];
+		}
+	}
+	return -1;
+}
+
+
+//----------------------------------  hash  --------------------------------------
+//	Hashes the characters of a description
+//	Preconditions:	none
+//	Postconditions:	the 64 bit FNV-1a hash of description is returned
+uint64_t DescriptionArena::hash(string_view description) {
+	uint64_t value = 14695981039346656037ULL;
+	for (char c : description) {
+		value ^= static_cast<unsigned char>(c);
+		value *= 1099511628211ULL;
+	}
+	return value;
+}
+
+
+//------------------------------  refreshViews  ----------------------------------
+//	Points the views at the memory the arena owns
+//	Preconditions:	the arena is not a view
+//	Postconditions:	the views and entries match offsets and text
+void DescriptionArena::refreshViews() {
+	offsetView = offsets.data();
+	textView = text.data();
+	entries = static_cast<int>(offsets.size()) - 1;
+}
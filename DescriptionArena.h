@@ -0,0 +1,164 @@
+//---------------------------------------------------------------------------------
+// DescriptionArena.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// DescriptionArena Class:	The descriptions of the vertices of a graph, kept end
+//							to end in one block of characters with an offset per
+//							description, and a hash index from each description
+//							back to its subscript.
+//
+//   --	allows reading descriptions one line at a time straight into the block,
+//		with no allocation per description
+//   --	allows adding a description from characters the caller holds
+//   --	allows viewing a block and offsets that live in memory the object does
+//		not own, such as a memory mapped snapshot file, without copying them
+//   --	allows reading a description as a view of the block
+//   --	allows finding the subscript of a description through an open addressing
+//		hash table of subscripts, once the index is built
+//
+// Assumptions:
+//   -- description i is the characters offsets[i] to offsets[i + 1] - 1
+//   -- descriptions are only added before the index is built, the finished
+//		object is not changed and is shared by the graphs that use it
+//   -- when two descriptions are the same, find returns the lower subscript
+//   -- viewed memory stays valid for as long as the keepAlive handle passed
+//		with it is held
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+class DescriptionArena {
+public:
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the DescriptionArena class
+	//	Preconditions:	none
+	//	Postconditions:	an empty arena with no descriptions is created
+	DescriptionArena();
+
+
+	//--------------------------------  reserve  -------------------------------------
+	//	Makes room for descriptions that are about to be added
+	//	Preconditions:	count and characters are greater than or equal to 0
+	//	Postconditions:	count more descriptions of characters characters in all can
+	//					be added without the block growing
+	void reserve(int count, size_t characters);
+
+
+	//----------------------------------  add  ---------------------------------------
+	//	Adds a description from characters the caller holds
+	//	Preconditions:	the arena is not a view. text holds length characters
+	//	Postconditions:	a copy of the characters is appended to the block as the next
+	//					description, and its subscript is returned
+	int add(const char* text, size_t length);
+
+
+	//--------------------------------  readLine  ------------------------------------
+	//	Reads the next description from a stream, the way getline reads a line
+	//	Preconditions:	the arena is not a view
+	//	Postconditions:	the characters up to the next '\n' are appended to the block as
+	//					the next description, and the '\n' is thrown away. at the end of
+	//					the stream eofbit is set, and failbit too if nothing was read.
+	//					the subscript of the description is returned
+	int readLine(istream& in);
+
+
+	//--------------------------------  attach  --------------------------------------
+	//	Makes this object a view of descriptions it does not own
+	//	Preconditions:	offsets holds count + 1 entries, text holds offsets[count]
+	//					characters. keepAlive keeps them valid
+	//	Postconditions:	the descriptions of this object are read from the given memory.
+	//					anything the object held before is released
+	void attach(const int64_t* offsets, const char* text, int count, shared_ptr<const void> keepAlive);
+
+
+	//-------------------------------  buildIndex  -----------------------------------
+	//	Builds the hash index that find reads
+	//	Preconditions:	first is greater than or equal to 0
+	//	Postconditions:	every description from subscript first on can be found. the
+	//					table has at least twice as many slots as descriptions, so a
+	//					lookup reads only a few slots
+	void buildIndex(int first);
+
+
+	//---------------------------------  find  ---------------------------------------
+	//	Finds the subscript of a description
+	//	Preconditions:	buildIndex has been called
+	//	Postconditions:	the lowest indexed subscript whose description is the same as
+	//					description is returned, or -1 if there is none
+	int find(string_view description) const;
+
+
+	//------------------------------  description  -----------------------------------
+	//	Returns one description
+	//	Preconditions:	entry is in the range 0 to count() - 1
+	//	Postconditions:	a view of the characters of the description in the block is
+	//					returned. it is valid as long as the arena is
+	string_view description(int entry) const {
+		return string_view(textView + offsetView[entry], static_cast<size_t>(offsetView[entry + 1] - offsetView[entry]));
+	}
+
+
+	//----------------------------------  count  -------------------------------------
+	//	Returns the number of descriptions
+	//	Preconditions:	none
+	//	Postconditions:	the number of descriptions is returned
+	int count() const { return entries; }
+
+
+	//------------------------------  offsetArray  -----------------------------------
+	//	Returns the count() + 1 offsets, for writing the descriptions out
+	//	Preconditions:	none
+	//	Postconditions:	a pointer to the offsets is returned
+	const int64_t* offsetArray() const { return offsetView; }
+
+
+	//-------------------------------  textArray  ------------------------------------
+	//	Returns the block of characters, for writing the descriptions out
+	//	Preconditions:	none
+	//	Postconditions:	a pointer to the offsetArray()[count()] characters is returned
+	const char* textArray() const { return textView; }
+
+private:
+	// what the arena owns when it is not a view
+	vector<int64_t> offsets;	// offsets[i] is the first character of description i
+	string text;				// every description, end to end
+
+	// the memory the descriptions are read from, owned or viewed
+	const int64_t* offsetView;
+	const char* textView;
+	int entries;				// number of descriptions
+	shared_ptr<const void> keepAlive;	// holds viewed memory
+
+	vector<int> slots;			// hash table of subscripts, -1 for an empty slot
+
+
+	//----------------------------------  hash  --------------------------------------
+	//	Hashes the characters of a description
+	//	Preconditions:	none
+	//	Postconditions:	the 64 bit FNV-1a hash of description is returned
+	static uint64_t hash(string_view description);
+
+
+	//------------------------------  refreshViews  ----------------------------------
+	//	Points the views at the memory the arena owns
+	//	Preconditions:	the arena is not a view
+	//	Postconditions:	the views and entries match offsets and text
+	void refreshViews();
+
+
+	// not copyable, the views point into the object's own memory. graphs share
+	// one arena instead
+	DescriptionArena(const DescriptionArena&) = delete;
+	DescriptionArena& operator=(const DescriptionArena&) = delete;
+};
@@ -0,0 +1,35 @@
+//---------------------------------------------------------------------------------
+// Distance.h
+// Author: Brent Barrese
+// Type Declarations
+//---------------------------------------------------------------------------------
+// Distance:	The type that shortest path distances are stored and compared in,
+//				shared by the Graph class and its frontier heap.
+//
+//   --	is a 32 bit integer by default, which keeps the tables of distances small
+//   --	is a 64 bit integer when DIJKSTRA_WIDE_DISTANCE is defined, for graphs
+//		whose paths can add up past the range of a 32 bit integer
+//   --	NO_DISTANCE stands for a vertex that cannot be reached
+//
+// Assumptions:
+//   -- edge weights are still stored as int, only sums of them are widened
+//   -- every file of the program is compiled with the same setting of
+//		DIJKSTRA_WIDE_DISTANCE
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include <cstdint>
+#include <limits>
+
+using namespace std;
+
+#ifdef DIJKSTRA_WIDE_DISTANCE
+typedef int64_t Distance;
+#else
+typedef int32_t Distance;
+#endif
+
+// distance of a vertex that has not been reached
+const Distance NO_DISTANCE = numeric_limits<Distance>::max();
@@ -4,39 +4,120 @@
 // Class Definitions
 //----------------------------------------------------------------------------------
 // Graph Class:	A graph class that reads data from a text file and stores it in 
-//				a Vertex object, an EdgeNode, or a VertexNode. It uses this data to 
+//				a DescriptionArena, an EdgeNode, or a VertexNode. It uses this data to 
 //				create a directed, weighted graph using an adjacency list implementation. 
 //				The class is primarily used to run Dijkstra's Algorithm but also 
 //				allows for other methods:
-//   --	allows reading data in from a file and putting into a graph
+//   --	allows reading data in from a file and putting into a graph, scanning the
+//		edges straight from the stream buffer and linking them in one pass
 //   --	computes the shortest path between every pair of vertices
 //   --	outputs a shortest path table that includes all possible paths and their 
 //		details from a source node to a destination node
+//   --	allows for writing that table through a large buffer to any stream or file
+//		descriptor, as text, comma or tab separated values, or binary records
 //   --	outputs individual paths from a source node to a destination node
+//   --	returns the path from a source node to a destination node as data, in a
+//		vector or a buffer the caller owns, without printing it
+//   --	keeps the vertex descriptions end to end in one shared block, read
+//		straight from the file with no allocation per vertex, and allows finding
+//		a vertex by its description through a hash index
+//   --	allows for saving a graph to a binary snapshot file and loading it back by
+//		memory mapping the file, with no parsing and no allocation per edge
 //   --	allows for inserting a directed edge when given a source vertex, destination
 //		vertex, and a weight
 //   --	allows for removing an edge when given the source and destination vertices
+//   --	allocates its edge nodes from a block pool it owns, so clearing the graph
+//		releases every node in one go
 //   --	allows for constructing a new graph with a parameter of an already existing
 //		graph
 //   --	allows for assigning an existing graph another existing graph
+//   --	allows for moving a graph into another graph in constant time
+//   --	allows for copies that share the compressed adjacency of the graph they
+//		were copied from, building their own adjacency lists only when an edge
+//		is inserted or removed
+//   --	allows for choosing how the next vertex is picked in Dijkstra's Algorithm,
+//		either a linear scan of the table, a scan using SIMD instructions, an
+//		indexed binary heap, or a radix heap of integer distances, or for
+//		running it as delta stepping with the edges of each bucket relaxed on
+//		several threads
+//   --	keeps a compressed sparse row copy of the adjacency lists that the 
+//		shortest path searches read from
+//   --	caches the shortest paths from each source vertex until an edge changes,
+//		computing them only for the source vertices that are asked about
+//   --	allows for repairing the cached paths when an edge changes instead of
+//		dropping them, touching only the sources the change affects
+//   --	keeps the table of each source as separate arrays of distances, previous
+//		vertices and visited bits, with 32 bit distances or, when built with
+//		DIJKSTRA_WIDE_DISTANCE, 64 bit distances
+//   --	allows for computing the rows of all sources on several threads at once
+//   --	answers a single source to destination query with a search that stops
+//		once the destination is reached, returning the path instead of printing
+//   --	allows for answering that query with a bidirectional search, which meets
+//		a search from the source and one from the destination in the middle
+//   --	answers a batch of source to destination queries with one run per
+//		distinct source, optionally spread over several threads
+//   --	allows for starting one search from several sources at once, each at its
+//		own starting distance, to find the nearest source of a set of targets
+//		or every vertex within a distance of the sources, and for stopping a
+//		one to many search once every target it lists is settled
+//   --	allows for answering a single query with an A* search guided by a
+//		heuristic: none, the straight line distance between vertex coordinates,
+//		or lower bounds from the distances to and from a few landmarks
+//   --	allows for choosing landmarks and computing their distances once, and
+//		saving them to a file that is only loaded back for a graph with the same
+//		edges
+//   --	allows for computing the shortest paths from every vertex, or from some,
+//		into a store whose cells are only as wide as the graph needs, kept in
+//		memory or in a file mapped into memory, with or without the paths
+//   --	runs single queries in a workspace that is kept from one query to the
+//		next, or one the caller keeps, so a query only resets what it touched
+//   --	allows for const queries, displays and reports that leave Table T alone
+//		and keep their state in a workspace the caller owns, so many threads can
+//		query one graph at once without locks
+//   --	when built with DIJKSTRA_STATS, counts what each search does and how long
+//		each phase takes, keeps the totals, and hands each table row and query
+//		to a trace callback. otherwise the counting is compiled out
 //
 // Assumptions:
 //   -- all pointers are initialized to nullptr unless instructed otherwise
 //   -- the file that buildGraph uses is in the same directory as the source file
 //   -- the default constructor creates a graph object and sets the VertexNode 
 //		variables to nullptr
-//   -- the VertexNodes being stored in the graph have a pointer to a Vertex object
-//		with a private variable holding a string
-//   -- there are not more than 100 vertices
+//   -- the description of vertex v is entry v of the description arena, entry 0
+//		is empty
+//   -- vertex storage is sized from the number of vertices read by buildGraph,
+//		so there is no fixed limit on the number of vertices
 //   -- the destructor will release all dynamic memory
+//   -- EdgeNodes are only created and destroyed through the graph's pool, never
+//		with new and delete
+//   -- vertex descriptions are not changed once they are read, so copies of the
+//		graph share them instead of copying them. coordinates are kept apart
+//		from them, and setCoordinates copies the coordinates first if they are
+//		shared
+//   -- when two vertices have the same description, findVertex returns the
+//		lower subscript
+//   -- coordinates are not written to snapshots
+//   -- the graph is not changed while const queries run on other threads. the
+//		first of them to find the compressed adjacency stale rebuilds it
 //   -- the file will have the correct vertices number in it to set size to the 
 //		correct integer value
 //----------------------------------------------------------------------------------
 
 
+#include <algorithm>
 #include <fstream>
 #include "Graph.h"
+#include "MappedFile.h"
+#include "MinScan.h"
+#include "ParallelFor.h"
+#include "RadixHeap.h"
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <cstring>
+#include <memory>
 #include <iomanip>
+#include <utility>
 using namespace std;
 
 
@@ -44,43 +125,159 @@ using namespace std;
 // Builds a graph by reading data from an ifstream
 // Preconditions:  infile has been successfully opened and the file contains
 //                 properly formated data (according to the program specs)
-// Postconditions: One graph is read from infile and stored in the object
+// Postconditions: One graph is read from infile and stored in the object, 
+//				   replacing anything the object held before. when an edge is
+//				   listed more than once, the last weight listed is kept
 void Graph::buildGraph(ifstream& infile) {
+	clearGraph();
+
 	infile >> size;						// data member stores array size
-	if (infile.eof())
+	if (infile.eof() || size < 0) {
+		size = 0;
 		return;
+	}
 	infile.ignore();					// throw away '\n' to go to next line
 
-	// get descriptions of vertices
+	// one VertexNode per vertex, subscript 0 is not used
+	vertices.assign(size + 1, VertexNode{ nullptr });
+
+	// get descriptions of vertices, each line read straight into the arena
+	shared_ptr<DescriptionArena> arena = make_shared<DescriptionArena>();
+	arena->add("", 0);					// vertex 0 has an empty description
 	for (int v = 1; v <= size; v++) {
-		vertices[v].data = new Vertex;
-		infile >> *vertices[v].data;	// use Vertex::operator>> to read descriptions
-		//Added to make nullptr
-		vertices[v].edgeHead = nullptr;
+		arena->readLine(infile);
 	}
+	arena->buildIndex(1);
+	descriptions = arena;
 
-	// fill cost edge array
+	// fill cost edge array, reading the numbers straight from the stream buffer
+	// and collecting them so they can be linked in one pass
+	vector<EdgeRecord> edges;
+	streambuf& buffer = *infile.rdbuf();
 	int src = 1, dest = 1, weight = 1;
 	for (;;) {
-		infile >> src >> dest >> weight;
-		if (src == 0 || infile.eof())
+		if (!scanInt(infile, buffer, src) || !scanInt(infile, buffer, dest) ||
+			!scanInt(infile, buffer, weight))
 			break;
-		insertEdge(src, dest, weight);
+		if (src == 0)
+			break;
+		edges.push_back(EdgeRecord{ src, dest, weight });
+	}
+	bulkInsertEdges(edges);
+
+	// loading is done, build the copy that queries read from
+	freezeAdjacency();
+}
+
+
+//------------------------------------ scanInt -------------------------------------
+//	Reads one integer straight from the buffer of a stream, skipping white space
+//	Preconditions:	buffer is the stream buffer of in
+//	Postconditions:	true is returned and value holds the integer if one was read.
+//					eofbit is set on in if the end of the input was reached and 
+//					failbit if no integer could be read, as operator>> would do
+bool Graph::scanInt(istream& in, streambuf& buffer, int& value) {
+	const int end = char_traits<char>::eof();
+	int c = buffer.sgetc();
+	while (c != end && isspace(c)) {
+		c = buffer.snextc();
+	}
+
+	bool negative = false;
+	if (c == '-' || c == '+') {
+		negative = (c == '-');
+		c = buffer.snextc();
+	}
+	if (c == end || !isdigit(c)) {
+		in.setstate(c == end ? ios::eofbit | ios::failbit : ios::failbit);
+		return false;
+	}
+
+	// numbers too large for an int are clamped, as operator>> does
+	long long number = 0;
+	while (c != end && isdigit(c)) {
+		if (number <= INT_MAX) {
+			number = number * 10 + (c - '0');
+		}
+		c = buffer.snextc();
+	}
+	if (c == end) {
+		in.setstate(ios::eofbit);
+	}
+	if (number > INT_MAX) {
+		number = INT_MAX;
+	}
+	value = static_cast<int>(negative ? -number : number);
+	return true;
+}
+
+
+//------------------------------  bulkInsertEdges  ---------------------------------
+//	Links a whole set of edges into the adjacency lists at once
+//	Preconditions:	the adjacency lists are empty. size is up to date
+//	Postconditions:	the edges are sorted by source and destination. edges with a
+//					negative weight or a vertex outside the graph are skipped, and
+//					for an edge listed more than once the last weight is kept, the
+//					same as calling insertEdge for each edge in order
+void Graph::bulkInsertEdges(vector<EdgeRecord>& edges) {
+	// drop the edges insertEdge would refuse
+	edges.erase(remove_if(edges.begin(), edges.end(), [this](const EdgeRecord& edge) {
+		return edge.weight < 0 || !isVertex(edge.source) || !isVertex(edge.destination);
+	}), edges.end());
+
+	// stable, so repeated edges stay in the order they were listed
+	stable_sort(edges.begin(), edges.end(), [](const EdgeRecord& a, const EdgeRecord& b) {
+		return a.source != b.source ? a.source < b.source : a.destination < b.destination;
+	});
+
+	// one pass: each row is appended at its tail, and of a run of repeated
+	// edges only the last one is linked
+	EdgeNode* tail = nullptr;
+	int tailSource = 0;
+	edgePool.reserve(static_cast<int>(edges.size()));
+	int count = static_cast<int>(edges.size());
+	for (int i = 0; i < count; i++) {
+		const EdgeRecord& edge = edges[i];
+		if (i + 1 < count && edges[i + 1].source == edge.source &&
+			edges[i + 1].destination == edge.destination) {
+			continue;
+		}
+
+		EdgeNode* newEdgeNode = edgePool.create();
+		newEdgeNode->adjVertex = edge.destination;
+		newEdgeNode->weight = edge.weight;
+		newEdgeNode->nextEdge = nullptr;
+
+		if (tailSource != edge.source) {
+			vertices[edge.source].edgeHead = newEdgeNode;
+		}
+		else {
+			tail->nextEdge = newEdgeNode;
+		}
+		tail = newEdgeNode;
+		tailSource = edge.source;
+		edgeCount++;
 	}
+	adjacencyStale = true;
+	tableStale = true;
 }
 
 
 //----------------------------------  constructor  ---------------------------------
 //	Default constructor the Graph class
 //	Preconditions:	there is enough space in memory for Graph object to be instantiated
-//	Postconditions:	all elements in vertices array have been initialized to nullptr.
+//	Postconditions:	the graph has no vertices and no storage is allocated for them.
 //					size of graph is initialized to 0
 Graph::Graph() {
-	for (int i = 0; i < MAX_VERTICES; i++) {
-		vertices[i].edgeHead = nullptr;
-		vertices[i].data = nullptr;
-	}
 	size = 0;
+	edgeCount = 0;
+	queueStrategy = AUTO_QUEUE;
+	threadCount = 1;
+	incrementalRepair = false;
+	adjacencyStale = true;
+	adjacencyListsMissing = false;
+	sharedTopology = false;
+	tableStale = false;
 }
 
 
@@ -91,20 +288,30 @@ Graph::Graph() {
 //					previously been instantiated.
 //	Postconditions:	a new Graph object is created that is identical to graph
 Graph::Graph(const Graph& graph) {
-	// set EdgeNode* and VertexNode* to nullptr initially
-	for (int i = 0; i < MAX_VERTICES; i++) {
-		vertices[i].edgeHead = nullptr;
-		vertices[i].data = nullptr;
-	}
-	
 	//copy size
 	size = graph.size;
+	edgeCount = graph.edgeCount;
+	queueStrategy = graph.queueStrategy;
+	threadCount = graph.threadCount;
+	incrementalRepair = graph.incrementalRepair;
+	sharedTopology = graph.sharedTopology;
+	traceCallback = graph.traceCallback;
 
 	//call copyGraph function
 	copyGraph(graph);
 }
 
 
+//-------------------------------  move constructor  -------------------------------
+//	Move constructor for the Graph class that takes the contents of another Graph
+//	Preconditions:	graph is a Graph object that has previously been instantiated
+//	Postconditions:	a new Graph object is created that holds what graph held, in
+//					constant time. graph is left empty
+Graph::Graph(Graph&& graph) : Graph() {
+	moveGraph(graph);
+}
+
+
 //----------------------------------  destructor  ----------------------------------
 //	Destructor for Graph class
 //	Preconditions:	calling Graph object has previously been instantiated. edgeHead
@@ -117,6 +324,289 @@ Graph::~Graph() {
 }
 
 
+//-----------------------------  freezeAdjacency  ----------------------------------
+//	Rebuilds the compressed sparse row copy of the adjacency lists if it is stale
+//	Preconditions:	vertices.edgeHead points to the head of each list
+//	Postconditions:	adjacency holds the same edges as the adjacency lists, in the
+//					same order, reverseAdjacency holds them turned around, and 
+//					adjacencyStale is false. when several const queries find it stale
+//					at once, one of them rebuilds it and the others wait for it
+void Graph::freezeAdjacency() const {
+	if (!adjacencyStale.load(memory_order_acquire)) {
+		return;
+	}
+	lock_guard<mutex> guard(freezeLock);
+	if (!adjacencyStale.load(memory_order_relaxed)) {
+		return;
+	}
+	// row 0 is kept empty so the rows line up with the vertex subscripts
+	adjacency.reset(size + 1, edgeCount);
+	adjacency.endRow();
+	for (int v = 1; v <= size; v++) {
+		for (EdgeNode* current = vertices[v].edgeHead; current != nullptr; current = current->nextEdge) {
+			adjacency.addEdge(current->adjVertex, current->weight);
+		}
+		adjacency.endRow();
+	}
+	reverseAdjacency.reverseOf(adjacency);
+	// publishes the rebuilt arrays to the queries that check the flag first
+	adjacencyStale.store(false, memory_order_release);
+}
+
+
+//------------------------------  thawAdjacency  -----------------------------------
+//	Builds the adjacency lists from the compressed adjacency when a snapshot was
+//	loaded and the lists have not been needed yet
+//	Preconditions:	adjacency is up to date
+//	Postconditions:	the adjacency lists hold the same edges as adjacency and
+//					adjacencyListsMissing is false
+void Graph::thawAdjacency() {
+	if (!adjacencyListsMissing) {
+		return;
+	}
+	edgePool.reserve(adjacency.edgeCount());
+	for (int v = 1; v <= size; v++) {
+		EdgeNode* tail = nullptr;
+		for (int edge = adjacency.rowBegin(v); edge < adjacency.rowEnd(v); edge++) {
+			EdgeNode* newEdgeNode = edgePool.create();
+			newEdgeNode->adjVertex = adjacency.adjVertexAt(edge);
+			newEdgeNode->weight = adjacency.weightAt(edge);
+			newEdgeNode->nextEdge = nullptr;
+			if (tail == nullptr) {
+				vertices[v].edgeHead = newEdgeNode;
+			}
+			else {
+				tail->nextEdge = newEdgeNode;
+			}
+			tail = newEdgeNode;
+		}
+	}
+	adjacencyListsMissing = false;
+}
+
+
+//-------------------------------  saveSnapshot  -----------------------------------
+//	Writes the graph to a binary snapshot file that loadSnapshot can map
+//	Preconditions:	none
+//	Postconditions:	the vertex descriptions and the compressed adjacency, forward
+//					and reverse, are written to fileName. true is returned if the
+//					file was written, otherwise false. the graph is not changed
+bool Graph::saveSnapshot(const string& fileName) {
+	freezeAdjacency();
+
+	// the arena is written as it is, vertex 0 has an empty description. a graph
+	// that was never built has no arena, and only the two empty offsets are written
+	static const int64_t noText[2] = { 0, 0 };
+	const int64_t* textOffsets = descriptions != nullptr ? descriptions->offsetArray() : noText;
+
+	SnapshotHeader header;
+	memcpy(header.magic, "DIJKSNAP", sizeof(header.magic));
+	header.version = SNAPSHOT_VERSION;
+	header.byteOrder = SNAPSHOT_BYTE_ORDER;
+	header.vertexCount = size;
+	header.edgeCount = adjacency.edgeCount();
+	header.textBytes = static_cast<uint64_t>(textOffsets[size + 1]);
+	header.fileBytes = snapshotBytes(size, header.edgeCount, header.textBytes);
+
+	ofstream outfile(fileName, ios::binary | ios::trunc);
+	if (!outfile) {
+		return false;
+	}
+	size_t rowBytes = sizeof(int32_t) * (size + 2);
+	size_t edgeBytes = sizeof(int32_t) * header.edgeCount;
+	outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	outfile.write(reinterpret_cast<const char*>(textOffsets), sizeof(int64_t) * (size + 2));
+	const CSRGraph* sections[] = { &adjacency, &reverseAdjacency };
+	for (const CSRGraph* section : sections) {
+		outfile.write(reinterpret_cast<const char*>(section->offsetArray()), rowBytes);
+		outfile.write(reinterpret_cast<const char*>(section->adjVertexArray()), edgeBytes);
+		outfile.write(reinterpret_cast<const char*>(section->weightArray()), edgeBytes);
+	}
+	if (header.textBytes > 0) {
+		outfile.write(descriptions->textArray(), static_cast<streamsize>(header.textBytes));
+	}
+	return static_cast<bool>(outfile.flush());
+}
+
+
+//-------------------------------  loadSnapshot  -----------------------------------
+//	Replaces the graph with one read from a binary snapshot file
+//	Preconditions:	fileName was written by saveSnapshot on a machine with the same
+//					byte order, and is not changed while the graph uses it
+//	Postconditions:	if the file is a snapshot of this version whose offsets and
+//					adjacent vertices are all in range, the graph holds the
+//					snapshot and true is returned. the edges are used in place from
+//					the mapped file, and the adjacency lists are only built if an 
+//					edge is inserted or removed. otherwise false is returned and the
+//					graph is not changed
+bool Graph::loadSnapshot(const string& fileName) {
+	shared_ptr<MappedFile> file = make_shared<MappedFile>();
+	if (!file->open(fileName) || file->length() < sizeof(SnapshotHeader)) {
+		return false;
+	}
+
+	// check the header before trusting any of the counts in it
+	SnapshotHeader header;
+	memcpy(&header, file->data(), sizeof(header));
+	if (memcmp(header.magic, "DIJKSNAP", sizeof(header.magic)) != 0 ||
+		header.version != SNAPSHOT_VERSION || header.byteOrder != SNAPSHOT_BYTE_ORDER ||
+		header.vertexCount < 0 || header.edgeCount < 0 ||
+		header.fileBytes != file->length() ||
+		header.fileBytes != snapshotBytes(header.vertexCount, header.edgeCount, header.textBytes)) {
+		return false;
+	}
+
+	// find each section in the mapped file, and check that every offset and
+	// adjacent vertex stays inside the file and no weight is negative before the
+	// graph reads through them
+	int count = header.vertexCount;
+	const char* cursor = file->data() + sizeof(SnapshotHeader);
+	const int64_t* textOffsets = reinterpret_cast<const int64_t*>(cursor);
+	cursor += sizeof(int64_t) * (count + 2);
+	if (!validTextOffsets(textOffsets, count, header.textBytes)) {
+		return false;
+	}
+	const int* offsets[2];
+	const int* adjVertex[2];
+	const int* weight[2];
+	for (int section = 0; section < 2; section++) {
+		offsets[section] = reinterpret_cast<const int*>(cursor);
+		cursor += sizeof(int32_t) * (count + 2);
+		adjVertex[section] = reinterpret_cast<const int*>(cursor);
+		cursor += sizeof(int32_t) * header.edgeCount;
+		weight[section] = reinterpret_cast<const int*>(cursor);
+		cursor += sizeof(int32_t) * header.edgeCount;
+		if (!validSection(offsets[section], adjVertex[section], weight[section], count,
+			header.edgeCount)) {
+			return false;
+		}
+	}
+	// the backward searches read the reverse section, so it has to hold the
+	// same edges as the forward one
+	if (!validTranspose(offsets[0], adjVertex[0], offsets[1], adjVertex[1], count)) {
+		return false;
+	}
+	const char* text = cursor;
+
+	clearGraph();
+	size = count;
+	edgeCount = header.edgeCount;
+	adjacency.attach(offsets[0], adjVertex[0], weight[0], size + 1, file);
+	reverseAdjacency.attach(offsets[1], adjVertex[1], weight[1], size + 1, file);
+
+	vertices.assign(size + 1, VertexNode{ nullptr });
+
+	// the descriptions are read in place from the mapped file too, only the index
+	// is built
+	shared_ptr<DescriptionArena> arena = make_shared<DescriptionArena>();
+	arena->attach(textOffsets, text, size + 1, file);
+	arena->buildIndex(1);
+	descriptions = arena;
+
+	adjacencyStale = false;
+	adjacencyListsMissing = true;
+	tableStale = true;
+	return true;
+}
+
+
+//------------------------------  snapshotBytes  -----------------------------------
+//	Computes the length of a snapshot file
+//	Preconditions:	vertexCount and edgeCount are greater than or equal to 0
+//	Postconditions:	the number of bytes in a snapshot with these counts is returned
+uint64_t Graph::snapshotBytes(int vertexCount, int edgeCount, uint64_t textBytes) {
+	uint64_t rows = static_cast<uint64_t>(vertexCount) + 2;
+	uint64_t edges = static_cast<uint64_t>(edgeCount);
+	return sizeof(SnapshotHeader) + sizeof(int64_t) * rows +
+		2 * sizeof(int32_t) * (rows + 2 * edges) + textBytes;
+}
+
+
+//-----------------------------  validTextOffsets  ---------------------------------
+//	Checks the description offsets of a snapshot
+//	Preconditions:	offsets holds vertexCount + 2 entries
+//	Postconditions:	true is returned if the offsets start at 0, never decrease and
+//					end no later than textBytes, otherwise false
+bool Graph::validTextOffsets(const int64_t* offsets, int vertexCount, uint64_t textBytes) {
+	if (offsets[0] != 0) {
+		return false;
+	}
+	for (int entry = 1; entry < vertexCount + 2; entry++) {
+		if (offsets[entry] < offsets[entry - 1]) {
+			return false;
+		}
+	}
+	return static_cast<uint64_t>(offsets[vertexCount + 1]) <= textBytes;
+}
+
+
+//-------------------------------  validSection  -----------------------------------
+//	Checks one adjacency section of a snapshot
+//	Preconditions:	offsets holds vertexCount + 2 entries, and adjVertex and weight
+//					hold edgeCount entries
+//	Postconditions:	true is returned if the offsets start at 0, never decrease and
+//					end at edgeCount, every adjacent vertex is in the range 1 to
+//					vertexCount and no weight is negative, otherwise false
+bool Graph::validSection(const int* offsets, const int* adjVertex, const int* weight,
+	int vertexCount, int edgeCount) {
+	if (offsets[0] != 0 || offsets[vertexCount + 1] != edgeCount) {
+		return false;
+	}
+	for (int row = 1; row < vertexCount + 2; row++) {
+		if (offsets[row] < offsets[row - 1]) {
+			return false;
+		}
+	}
+	for (int edge = 0; edge < edgeCount; edge++) {
+		if (adjVertex[edge] < 1 || adjVertex[edge] > vertexCount || weight[edge] < 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//------------------------------  validTranspose  ----------------------------------
+//	Checks that the reverse section of a snapshot matches the forward one
+//	Preconditions:	both sections passed validSection with the same vertexCount
+//	Postconditions:	true is returned if each vertex has as many edges into it in
+//					the forward section as it has in its row of the reverse section,
+//					and the other way around, otherwise false
+bool Graph::validTranspose(const int* forwardOffsets, const int* forwardAdjVertex,
+	const int* reverseOffsets, const int* reverseAdjVertex, int vertexCount) {
+	// each row's own count goes in, and each edge into the vertex takes one out.
+	// row 0 is not a vertex, so any edge in it is left over
+	vector<int> forwardIn(vertexCount + 1, 0);
+	vector<int> reverseIn(vertexCount + 1, 0);
+	for (int v = 0; v <= vertexCount; v++) {
+		forwardIn[v] += reverseOffsets[v + 1] - reverseOffsets[v];
+		reverseIn[v] += forwardOffsets[v + 1] - forwardOffsets[v];
+		for (int edge = forwardOffsets[v]; edge < forwardOffsets[v + 1]; edge++) {
+			forwardIn[forwardAdjVertex[edge]]--;
+		}
+		for (int edge = reverseOffsets[v]; edge < reverseOffsets[v + 1]; edge++) {
+			reverseIn[reverseAdjVertex[edge]]--;
+		}
+	}
+	for (int v = 0; v <= vertexCount; v++) {
+		if (forwardIn[v] != 0 || reverseIn[v] != 0) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//---------------------------------  isVertex  -------------------------------------
+//	Checks whether a vertex subscript refers to a vertex in the graph
+//	Preconditions:	none
+//	Postconditions:	true is returned if vertex is in the range 1 to size, otherwise
+//					false. graph object is not changed
+bool Graph::isVertex(int vertex) const {
+	return vertex >= 1 && vertex <= size;
+}
+
+
 //---------------------------------  clearGraph  -----------------------------------
 //	Clears the Graph object and deallocates any dynamic memory
 //	Preconditions:	the edgeHead EdgeNodes point to the first element in the list. 
@@ -124,24 +614,21 @@ Graph::~Graph() {
 //	Postconditions:	the Graph object is empty and has no EdgeNodes or dynamically
 //					allocated memory
 void Graph::clearGraph() {
-	EdgeNode* current;
-	EdgeNode* temp;
-	if (size > 0) {
-		// Start at 1 and walk through each list, deleting edgeNodes
-		for (int i = 1; i <= size; i++) {
-			current = vertices[i].edgeHead;
-			while (current != nullptr) {
-				temp = current;
-				current = current->nextEdge;
-				delete temp;
-			}
-			// set edgehead to nullptr to avoid loop in future
-			vertices[i].edgeHead = nullptr;
-			// delete dynamically allocated vertex object
-			delete vertices[i].data;
-			vertices[i].data = nullptr;
-		}
-	}
+	// the EdgeNodes need no destructor, so they are released with their pool, and
+	// the descriptions are freed once no copy of the graph shares them
+	edgePool.releaseAll();
+	descriptions = nullptr;
+	locations = nullptr;
+	vertices.clear();
+	adjacency.clear();
+	reverseAdjacency.clear();
+	smallAdjacency.clear();
+	adjacencyStale = true;
+	adjacencyListsMissing = false;
+	T.clear();
+	tableStale = false;
+	size = 0;
+	edgeCount = 0;
 }
 
 
@@ -161,6 +648,12 @@ Graph& Graph::operator=(const Graph& fromGraph) {
 		
 		//copy private members
 		size = fromGraph.size;
+		edgeCount = fromGraph.edgeCount;
+		queueStrategy = fromGraph.queueStrategy;
+		threadCount = fromGraph.threadCount;
+		incrementalRepair = fromGraph.incrementalRepair;
+		sharedTopology = fromGraph.sharedTopology;
+		traceCallback = fromGraph.traceCallback;
 
 		// call copyGraph function
 		copyGraph(fromGraph);
@@ -170,6 +663,23 @@ Graph& Graph::operator=(const Graph& fromGraph) {
 }
 
 
+//---------------------------  move assignment operator  ---------------------------
+//	Overloaded assignment operator that moves a Graph object into a pre-existing
+//	Graph object
+//	Preconditions:	none
+//	Postconditions:	the data of this Graph object is released and this object holds
+//					what fromGraph held, in constant time. fromGraph is left empty
+Graph& Graph::operator=(Graph&& fromGraph) {
+	// check for self assignment
+	if (this != &fromGraph) {
+		clearGraph();
+		moveGraph(fromGraph);
+	}
+
+	return *this;
+}
+
+
 //----------------------------------  insertEdge  ----------------------------------
 //	Inserts an edge into the Graph object. The edge is weighted and directed
 //	Preconditions:	the parameters must all be integer values. the weight must be
@@ -187,9 +697,14 @@ bool Graph::insertEdge(int sourceVertex, int destinationVertex, int weight) {
 	if (weight < 0) {
 		return false;
 	}
+	// Only insert between vertices that are in the graph
+	if (!isVertex(sourceVertex) || !isVertex(destinationVertex)) {
+		return false;
+	}
+	thawAdjacency();
 	
 	//Create the edgeNode
-	EdgeNode* newEdgeNode = new EdgeNode;
+	EdgeNode* newEdgeNode = edgePool.create();
 	newEdgeNode->adjVertex = destinationVertex;
 	newEdgeNode->weight = weight;
 	newEdgeNode->nextEdge = nullptr;
@@ -198,23 +713,34 @@ bool Graph::insertEdge(int sourceVertex, int destinationVertex, int weight) {
 	//Check if any nodes already in list
 	if (vertices[sourceVertex].edgeHead == nullptr) {
 		vertices[sourceVertex].edgeHead = newEdgeNode;
+		edgeCount++;
+		adjacencyStale = true;
+		repairTable(sourceVertex, destinationVertex, INT_MAX, weight);
 		return true;
 	}
 	else {
 		// Add edge to list OR replace any previous edge that existed between the two vertices
 		EdgeNode* current = vertices[sourceVertex].edgeHead;
-		// loop until finding the edge already in list or hitting nullptr
-		while (current->nextEdge != nullptr) {
+		adjacencyStale = true;
+		// loop until finding the edge already in list or reaching the last edge
+		for (;;) {
 			//Check if the edge exists and replace weight
 			if (current->adjVertex == destinationVertex) {
+				int oldWeight = current->weight;
 				current->weight = weight;
-				delete newEdgeNode;
+				edgePool.destroy(newEdgeNode);
+				repairTable(sourceVertex, destinationVertex, oldWeight, weight);
 				return true;
 			}
-			current = current->nextEdge;			
+			if (current->nextEdge == nullptr) {
+				break;
+			}
+			current = current->nextEdge;
 		}
 		current->nextEdge = newEdgeNode;
+		edgeCount++;
 	}
+	repairTable(sourceVertex, destinationVertex, INT_MAX, weight);
 	return true;
 }
 
@@ -230,6 +756,10 @@ bool Graph::insertEdge(int sourceVertex, int destinationVertex, int weight) {
 //					otherwise, false is returned.
 bool Graph::removeEdge(int sourceVertex, int destinationVertex) {
 	// nothing in list
+	if (!isVertex(sourceVertex)) {
+		return false;
+	}
+	thawAdjacency();
 	if (vertices[sourceVertex].edgeHead == nullptr) {
 		return false;
 	}
@@ -241,7 +771,11 @@ bool Graph::removeEdge(int sourceVertex, int destinationVertex) {
 		if (vertices[sourceVertex].edgeHead->adjVertex == destinationVertex) {
 			// delete and change head
 			vertices[sourceVertex].edgeHead = vertices[sourceVertex].edgeHead->nextEdge;
-			delete current;
+			int oldWeight = current->weight;
+			edgePool.destroy(current);
+			edgeCount--;
+			adjacencyStale = true;
+			repairTable(sourceVertex, destinationVertex, oldWeight, INT_MAX);
 			return true;
 		}
 		// start walking through adjacency list
@@ -254,7 +788,11 @@ bool Graph::removeEdge(int sourceVertex, int destinationVertex) {
 				return false;
 			}
 			previous->nextEdge = current->nextEdge;
-			delete current;
+			int oldWeight = current->weight;
+			edgePool.destroy(current);
+			edgeCount--;
+			adjacencyStale = true;
+			repairTable(sourceVertex, destinationVertex, oldWeight, INT_MAX);
 			return true;
 			}
 		}
@@ -265,24 +803,160 @@ bool Graph::removeEdge(int sourceVertex, int destinationVertex) {
 //	A method that finds the shortest path from all source vertices to all destination
 //	vertices
 //	Preconditions:	Table T exists in the Graph object. all vertices that the algorithm
-//					is asked to run for have been added to the graph. MAX_VERTICES is
-//					an accurate value of the maximum amount of vertices allowed in
-//					the graph
+//					is asked to run for have been added to the graph
 //	Postconditions:	the algorithm for finding the shortest path is ran with every
 //					requested vertex as the source vertex. the private member Table T is 
-//					updated with results from the algorithm. 
+//					updated with results from the algorithm. rows of Table T that are
+//					already up to date are not computed again
 void Graph::findShortestPath() {
-	// Initialize all valid vertices in table (start at 1,1?) or at(0,0)
-	for (int row = 0; row < MAX_VERTICES; row++) {
-		for (int column = 0; column < MAX_VERTICES; column++) {
-			T[row][column].dist = INT_MAX;
-			T[row][column].path = 0;
-			T[row][column].visited = false;
+	prepareTable();
+
+	// Call helper that passes source vertex and runs for all vertex in range.
+	// each source only writes its own row of T, so the rows are independent
+	parallelFor(1, size + 1, sourceThreadCount(), [this](int source) {
+		computeRow(source);
+	});
+}
+
+
+//--------------------------------  prepareTable  ----------------------------------
+//	Gets Table T and the compressed adjacency ready for computing rows
+//	Preconditions:	none
+//	Postconditions:	T has one row per vertex. if an edge changed since the rows were
+//					computed, every row is emptied. adjacency is up to date, and
+//					so is smallAdjacency if the strategy reads it and the graph fits
+void Graph::prepareTable() {
+	if (tableStale || static_cast<int>(T.size()) != size + 1) {
+		T.assign(size + 1, TableRow());
+		tableStale = false;
+	}
+
+	// searches read the edges from the compressed copy
+	freezeAdjacency();
+
+	// the heap and radix heap rows read a 16 bit copy instead when the graph fits
+	if (queueStrategy == RADIX_HEAP || (queueStrategy != DELTA_STEPPING && useHeap())) {
+		prepareSmallAdjacency();
+	}
+}
+
+
+//---------------------------  prepareSmallAdjacency  ------------------------------
+//	Brings the 16 bit copy of adjacency up to date
+//	Preconditions:	adjacency is up to date
+//	Postconditions:	smallAdjacency is a copy of adjacency if the graph fits it,
+//					otherwise it is empty
+void Graph::prepareSmallAdjacency() {
+	if (!smallAdjacency.builtFrom(adjacency)) {
+		if (SmallAdjacency::fits(adjacency)) {
+			smallAdjacency.build(adjacency);
+		}
+		else {
+			smallAdjacency.clear();
 		}
 	}
-	// Call helper that passes source vertex and runs for all vertex in range
-	for (int i = 1; i <= size; i++) {
-		findShortestPathHelper(i);
+}
+
+
+//---------------------------------  computeRow  -----------------------------------
+//	Computes the shortest paths from a source vertex if they are not cached
+//	Preconditions:	prepareTable has been called. source is a vertex in the graph
+//	Postconditions:	row source of Table T holds the shortest distance and the path
+//					from source to every vertex. a cached row is not computed again
+void Graph::computeRow(int source) {
+	if (!T[source].empty()) {
+		return;
+	}
+	SearchStats stats;
+	SEARCH_CLOCK(setupStart);
+	// Initialize all valid vertices in the row, column 0 is not used
+	T[source].dist.assign(size + 1, NO_DISTANCE);
+	T[source].path.assign(size + 1, 0);
+	T[source].visited.assign((size + 1 + 63) / 64, 0);
+	SEARCH_PHASE(stats, setupNanoseconds, setupStart);
+
+	SEARCH_CLOCK(searchStart);
+	findShortestPathHelper(source, stats);
+	SEARCH_PHASE(stats, searchNanoseconds, searchStart);
+	SEARCH_STATS_ONLY(recordSearch(QueryTrace{ TABLE_ROW, source, 0, stats }));
+}
+
+
+//-------------------------------  repairTable  -----------------------------------
+//	Brings the cached rows of Table T up to date after the weight of an edge changed
+//	Preconditions:	the adjacency lists hold the changed edge. oldWeight and newWeight
+//					are the weight before and after the change, INT_MAX for no edge
+//	Postconditions:	if incrementalRepair is false, every row is marked stale. 
+//					otherwise rows the change shortens are repaired in place, rows
+//					whose shortest path tree used the edge are emptied, and the rest
+//					are kept as they are
+void Graph::repairTable(int sourceVertex, int destinationVertex, int oldWeight, int newWeight) {
+	if (!incrementalRepair || tableStale) {
+		tableStale = true;
+		return;
+	}
+	if (newWeight == oldWeight || static_cast<int>(T.size()) != size + 1) {
+		return;
+	}
+
+	if (newWeight > oldWeight) {
+		// only the rows that reach destinationVertex through the edge can get longer,
+		// and those are computed again when they are next asked for
+		for (int source = 1; source <= size; source++) {
+			if (!T[source].empty() && destinationVertex != source && 
+				T[source].path[destinationVertex] == sourceVertex) {
+				T[source] = TableRow();
+			}
+		}
+		return;
+	}
+
+	// a shorter edge can only improve the rows where it beats the known distance
+	IndexedHeap frontier(size + 1);
+	for (int source = 1; source <= size; source++) {
+		if (T[source].empty() || T[source].dist[sourceVertex] == NO_DISTANCE) {
+			continue;
+		}
+		Distance throughEdge = T[source].dist[sourceVertex] + newWeight;
+		if (throughEdge < T[source].dist[destinationVertex]) {
+			T[source].dist[destinationVertex] = throughEdge;
+			T[source].path[destinationVertex] = sourceVertex;
+			T[source].markVisited(destinationVertex);
+			propagateDecrease(source, destinationVertex, frontier);
+		}
+	}
+}
+
+
+//----------------------------  propagateDecrease  --------------------------------
+//	Spreads a shortened distance through one cached row of Table T
+//	Preconditions:	row source of T is cached, and vertex has just been given a
+//					shorter distance in it. frontier is empty
+//	Postconditions:	every vertex whose distance from source got shorter through
+//					vertex has its distance and path updated. frontier is empty
+void Graph::propagateDecrease(int source, int vertex, IndexedHeap& frontier) {
+	TableRow& row = T[source];
+	frontier.push(vertex, row.dist[vertex]);
+
+	// Dijkstra's Algorithm over only the vertices that improve, reading the lists
+	// since the compressed adjacency is stale after an edge change
+	while (!frontier.isEmpty()) {
+		int current = frontier.popMin();
+		for (EdgeNode* edge = vertices[current].edgeHead; edge != nullptr; edge = edge->nextEdge) {
+			int adjacent = edge->adjVertex;
+			if (row.dist[adjacent] > row.dist[current] + edge->weight) {
+				row.dist[adjacent] = row.dist[current] + edge->weight;
+				row.path[adjacent] = current;
+				row.markVisited(adjacent);
+
+				if (frontier.contains(adjacent)) {
+					frontier.decreaseKey(adjacent, row.dist[adjacent]);
+				}
+				else {
+					frontier.push(adjacent, row.dist[adjacent]);
+				}
+			}
+		}
 	}
 }
 
@@ -291,44 +965,71 @@ void Graph::findShortestPath() {
 //	A helper function to findShortestPath that runs Dijkstra's Algorithm from a 
 //	source vertex
 //	Preconditions:	the value being passed in as a parameter to the function is an 
-//					integer. the private member Table T has been initialized.
+//					integer. row source of Table T has been initialized.
 //	Postconditions:	Dijkstra's Algorithm is ran to every available destination vertex
 //					from the source vertex. if a shorter path is found to the 
 //					destination vertex then Table T is updated to reflect the newly
 //					discovered lowest weight and the path it came from.
-//
-void Graph::findShortestPathHelper(int source) {
+//					what the search did is added to stats
+void Graph::findShortestPathHelper(int source, SearchStats& stats) {
+	if (queueStrategy == RADIX_HEAP) {
+		findShortestPathRadix(source, stats);
+	}
+	else if (queueStrategy == DELTA_STEPPING) {
+		findShortestPathDelta(source, stats);
+	}
+	else if (useHeap()) {
+		findShortestPathHeap(source, stats);
+	}
+	else if (queueStrategy == LINEAR_SCAN) {
+		findShortestPathLinear(source, stats);
+	}
+	else {
+		findShortestPathVector(source, stats);
+	}
+}
+
+
+//--------------------------  findShortestPathLinear  ------------------------------
+//	Runs Dijkstra's Algorithm from a source vertex, picking the next vertex with a
+//	linear scan of the table row
+//	Preconditions:	the value being passed in as a parameter to the function is an 
+//					integer. the private member Table T has been initialized.
+//	Postconditions:	row source of Table T holds the shortest distance and the path
+//					from source to every vertex that can be reached
+//					the counts of the search are added to stats
+void Graph::findShortestPathLinear(int source, SearchStats& stats) {
 	// Set sourceVertex = 0
-	T[source][source].dist = 0;
-	T[source][source].path = source;
+	T[source].dist[source] = 0;
+	T[source].path[source] = source;
 
 	// repeat n-1 times
 	for (int i = 1; i < size; i++) {
 		// let v be the unvisited vertex with minimum Dv
-		int vertex = lowestWeightVertex(source);
+		int vertex = lowestWeightVertex(source, stats);
 		// what if vertex 0 returned?
 		if (vertex > 0) {
 			// mark v as visited
-			T[source][vertex].visited = true;
-
-			// Go to head of vertex			
-			EdgeNode* current = vertices[vertex].edgeHead;
+			T[source].markVisited(vertex);
+			SEARCH_COUNT(stats, settled, 1);
+			SEARCH_COUNT(stats, edgesScanned, adjacency.rowEnd(vertex) - adjacency.rowBegin(vertex));
 
 			// for each vertex w adjacent to v
-			while (current != nullptr) {
+			for (int edge = adjacency.rowBegin(vertex); edge < adjacency.rowEnd(vertex); edge++) {
+				int adjacent = adjacency.adjVertexAt(edge);
 				// if w is not visited and Dw > Dv +Dv->w
-				if (T[source][current->adjVertex].visited == false) {
+				if (!T[source].isVisited(adjacent)) {
 					
-					if (T[source][current->adjVertex].dist > (T[source][vertex].dist + current->weight)) {
+					if (T[source].dist[adjacent] > (T[source].dist[vertex] + adjacency.weightAt(edge))) {
 
 						// set Dw = Dv + dv,w
-						T[source][current->adjVertex].dist = T[source][vertex].dist + current->weight;
+						T[source].dist[adjacent] = T[source].dist[vertex] + adjacency.weightAt(edge);
+						SEARCH_COUNT(stats, relaxed, 1);
 
 						// set pathw = v
-						T[source][current->adjVertex].path = vertex;
+						T[source].path[adjacent] = vertex;
 					}
 				}
-				current = current->nextEdge;
 			}
 		}
 		else {
@@ -338,133 +1039,1790 @@ void Graph::findShortestPathHelper(int source) {
 }
 
 
-//----------------------------  lowestWeightVertex  --------------------------------
-//	A helper method that finds the next lowest weight vertex that has not been 
-//	visited yet
-//	Preconditions:	the parameter passed in is an integer. the private data member 
-//					of the calling Graph object, Table T, has been being kept updated
-//					by the findShortestPath algorithm.
-//	Postconditions: no changes made to the Graph object. the vertex that has not been
-//					visited and has the lowest weight is returned to the calling
-//					object. If no vertex is found, then 0 is returned.
-int Graph::lowestWeightVertex(int source) const {
-	int lowestWeight = INT_MAX;
-	int returnVertex = 0;
-	for (int i = 1; i <= size; i++) {
-		if (T[source][i].visited == false && T[source][i].dist < lowestWeight) {
-			lowestWeight = T[source][i].dist;
-			returnVertex = i;
-		}
-	}
-	return returnVertex;
-}
-
-
-//----------------------------------  displayAll  ----------------------------------
-//	Displays the shortest path from all vertices in the graph to all vertices in
-//	the graph
-//	Preconditions:	the private data member of Graph, Table T, is accurate and up to
-//					data. all vertex pointers in VertexNode point to a vertex object
-//	Postconditions:	the findShortestPath function is called to update the 
-//					private data member Table T. for each vertex, all data from the 
-//					vertex to a destination vertex is printed in a table format. the 
-//					source vertex, destination vertex, distance travelled, and path
-//					travelled are printed in a table format.
-void Graph::displayAll() {
-	// Update graph by calling findShortestPath
-	findShortestPath();
+//--------------------------  findShortestPathVector  ------------------------------
+//	Runs Dijkstra's Algorithm from a source vertex, picking the next vertex with a
+//	vectorized scan of the keys of the unvisited vertices
+//	Preconditions:	the value being passed in as a parameter to the function is an 
+//					integer. the private member Table T has been initialized.
+//	Postconditions:	row source of Table T holds the same distances and paths as
+//					findShortestPathLinear gives
+//					the counts of the search are added to stats
+void Graph::findShortestPathVector(int source, SearchStats& stats) {
+	TableRow& row = T[source];
+	row.dist[source] = 0;
+	row.path[source] = source;
 
-	cout << "Description" << setw(16) << "From" << setw(6) << "To" << setw(6) << "Dist" << setw(6) << "Path" << endl;
-	//cout << "Description\t\t" << "From\t" << "To\t" << "Dist\t" << "Path" << endl;
+	// the keys are the distances with every visited vertex set to NO_DISTANCE, so
+	// the scan needs no test of the visited bits. column 0 is not scanned
+	vector<Distance> keys(size + 1, NO_DISTANCE);
+	keys[source] = 0;
 
-	for (int i = 1; i <= size; i++) {
-		cout << *vertices[i].data << endl;
-		for (int j = 1; j <= size; j++) {
-			if (i != j) {
-				cout << setw(26) << i;
-				cout << setw(6) << j;
-				// Print distance stored in table array
-				// Check if valid by looking for distance < INT_MAX (infinity)
-				if (T[i][j].dist < INT_MAX) {
-					cout << setw(6) << T[i][j].dist;
-				}
-				else {
-					cout << setw(6) << "--";
-				}
+	// repeat n-1 times, as the linear scan does
+	for (int i = 1; i < size; i++) {
+		int vertex = findMinimum(keys.data() + 1, size) + 1;
+		SEARCH_COUNT(stats, scanned, size);
+		if (vertex == 0) {
+			return;
+		}
+		row.markVisited(vertex);
+		keys[vertex] = NO_DISTANCE;
+		SEARCH_COUNT(stats, settled, 1);
+		SEARCH_COUNT(stats, edgesScanned, adjacency.rowEnd(vertex) - adjacency.rowBegin(vertex));
 
-				// Recursive helper for path
-				cout << setw(4);
-				printPath(i, j);
-				cout << endl;
+		for (int edge = adjacency.rowBegin(vertex); edge < adjacency.rowEnd(vertex); edge++) {
+			int adjacent = adjacency.adjVertexAt(edge);
+			Distance newDist = row.dist[vertex] + adjacency.weightAt(edge);
+			if (!row.isVisited(adjacent) && row.dist[adjacent] > newDist) {
+				row.dist[adjacent] = newDist;
+				row.path[adjacent] = vertex;
+				keys[adjacent] = newDist;
+				SEARCH_COUNT(stats, relaxed, 1);
 			}
 		}
-		cout << endl;
 	}
 }
 
 
-//----------------------------  printPath  -------------------------------------------
-//	A helper method that recursively finds the path from a source vertex to a destination
-//	vertex
-//	Preconditions:	the parameters passed in are integer values. Table T is updated.		
-//	Postconditions:	the destination is printed recursively for each source vertex, 
-//					resulting in a path from a source vertex to a destination vertex.
-//					graph object is not changed.
-void Graph::printPath(const int& source, const int& destination) const{
-	// IF path is 0, skip loop and do not print anything (there is no path)
-	if (T[source][destination].path > 0) {
-		if (source != destination) {
-			printPath(source, T[source][destination].path);
-		}
-		cout << " " << destination;
+//---------------------------  findShortestPathHeap  -------------------------------
+//	Runs Dijkstra's Algorithm from a source vertex, picking the next vertex from an
+//	indexed binary heap of the vertices reached so far
+//	Preconditions:	the value being passed in as a parameter to the function is an 
+//					integer. the private member Table T has been initialized.
+//	Postconditions:	row source of Table T holds the shortest distance and the path
+//					from source to every vertex that can be reached
+//					the counts of the search are added to stats
+void Graph::findShortestPathHeap(int source, SearchStats& stats) {
+	// the choice is made once per row, the loop itself is compiled for each
+	if (smallAdjacency.builtFrom(adjacency)) {
+		HeapQueue<uint16_t> frontier(size + 1);
+		runDijkstra<true>(source, smallAdjacency, T[source], frontier, stats);
+	}
+	else {
+		HeapQueue<int> frontier(size + 1);
+		runDijkstra<true>(source, adjacency, T[source], frontier, stats);
 	}
 }
 
 
-//------------------------------------  display  -----------------------------------
-//	Displays a single, detailed path from a source vertex to a destination vertex
-//	Preconditions:	the parameters passed in are integer values. all vertex pointers 
-//					in VertexNode point to a vertex object		
-//	Postconditions:	the findShortestPath function is called to update the 
-//					private data member Table T. The specific data from the requested
-//					source vertex to destination vertex is printed including the 
-//					source vertex, destination vertex, distance travelled, exact path,
-//					and the name of the vertex. 
-void Graph::display(int source, int destination) {
-	// Update graph by calling findShortestPath
+//---------------------------  findShortestPathRadix  ------------------------------
+//	Runs Dijkstra's Algorithm from a source vertex, picking the next vertex from a
+//	radix heap of the vertices reached so far
+//	Preconditions:	the value being passed in as a parameter to the function is an 
+//					integer. the private member Table T has been initialized.
+//	Postconditions:	row source of Table T holds the shortest distance and a
+//					shortest path from source to every vertex that can be reached
+//					the counts of the search are added to stats
+void Graph::findShortestPathRadix(int source, SearchStats& stats) {
+	if (smallAdjacency.builtFrom(adjacency)) {
+		RadixQueue<uint16_t> frontier(size + 1);
+		runDijkstra<true>(source, smallAdjacency, T[source], frontier, stats);
+	}
+	else {
+		RadixQueue<int> frontier(size + 1);
+		runDijkstra<true>(source, adjacency, T[source], frontier, stats);
+	}
+}
+
+
+//--------------------------------  runDijkstra  ----------------------------------
+//	Runs Dijkstra's Algorithm from a source vertex, compiled for one edge storage,
+//	one frontier policy and whether the paths are kept
+//	Preconditions:	every distance of row is NO_DISTANCE and no vertex of it is
+//					visited. if TRACK_PATHS, row.path has an entry for every vertex.
+//					frontier is empty and holds every vertex subscript of edges
+//	Postconditions:	row holds the shortest distance from source to every vertex
+//					that can be reached along edges and, if TRACK_PATHS, the vertex
+//					before each one on a shortest path. frontier is empty. the
+//					counts of the search are added to stats
+template <bool TRACK_PATHS, class Adjacency, class Queue>
+void Graph::runDijkstra(int source, const Adjacency& edges, TableRow& row, Queue& frontier,
+	SearchStats& stats) {
+	row.dist[source] = 0;
+	if constexpr (TRACK_PATHS) {
+		row.path[source] = source;
+	}
+
+	// only vertices that have been reached are in the frontier
+	frontier.push(source, 0);
+	SEARCH_COUNT(stats, heapPushes, 1);
+
+	while (!frontier.isEmpty()) {
+		// let v be the unvisited vertex with minimum Dv
+		Distance key;
+		auto vertex = frontier.popMin(key);
+		// an entry left behind when the vertex was reached again by a shorter path.
+		// a frontier that never leaves one compiles without the test
+		if constexpr (Queue::HOLDS_STALE) {
+			if (row.isVisited(vertex) || key != row.dist[vertex]) {
+				continue;
+			}
+		}
+		row.markVisited(vertex);
+		SEARCH_COUNT(stats, settled, 1);
+		SEARCH_COUNT(stats, edgesScanned, edges.rowEnd(vertex) - edges.rowBegin(vertex));
+
+		// for each vertex w adjacent to v
+		Distance vertexDist = row.dist[vertex];
+		for (int edge = edges.rowBegin(vertex); edge < edges.rowEnd(vertex); edge++) {
+			auto adjacent = edges.adjVertexAt(edge);
+			Distance newDist = vertexDist + edges.weightAt(edge);
+			if (!row.isVisited(adjacent) && row.dist[adjacent] > newDist) {
+				// set Dw = Dv + dv,w and pathw = v
+				row.dist[adjacent] = newDist;
+				if constexpr (TRACK_PATHS) {
+					row.path[adjacent] = vertex;
+				}
+				frontier.lower(adjacent, newDist, stats);
+				SEARCH_COUNT(stats, relaxed, 1);
+			}
+		}
+	}
+}
+
+
+//--------------------------------  searchRows  -----------------------------------
+//	Runs Dijkstra's Algorithm from each of a list of sources outside Table T, with
+//	one row and one frontier per worker reused from source to source
+//	Preconditions:	edges has a row for every vertex subscript of the graph
+//	Postconditions:	store(i, row) is called once for each subscript i of sources,
+//					with row holding the distances from sources[i] along edges
+//					and, if TRACK_PATHS, the vertex before each vertex reached.
+//					the calls run on as many threads as setThreadCount allows, each
+//					with a row of its own. Table T is not changed
+template <bool TRACK_PATHS, class Adjacency, class Queue, class Store>
+void Graph::searchRows(const vector<int>& sources, const Adjacency& edges, const Store& store) const {
+	int count = static_cast<int>(sources.size());
+	int workers = min(resolveThreadCount(threadCount), count);
+
+	// each worker takes the next source left, so one slow row does not hold up
+	// the sources behind it
+	atomic<int> next(0);
+	parallelFor(0, workers, workers, [&](int) {
+		TableRow row;
+		Queue frontier(size + 1);
+		SearchStats stats;
+		for (int i = next++; i < count; i = next++) {
+			// a search sets the path of every vertex it reaches, and no other entry
+			// of the path is read, so only the distances and the marks are cleared
+			row.dist.assign(size + 1, NO_DISTANCE);
+			row.visited.assign((size + 1 + 63) / 64, 0);
+			if constexpr (TRACK_PATHS) {
+				row.path.resize(size + 1);
+			}
+			frontier.clear();
+			runDijkstra<TRACK_PATHS>(sources[i], edges, row, frontier, stats);
+			store(i, row);
+		}
+	});
+}
+
+
+//-----------------------------  searchRowsAlong  ----------------------------------
+//	Runs searchRows along adjacency or reverseAdjacency with the storage and the
+//	frontier the queue strategy picks
+//	Preconditions:	the compressed adjacency and smallAdjacency are up to date
+//	Postconditions:	the same as searchRows. forward rows read smallAdjacency when it
+//					is built, and the rows use the radix heap with RADIX_HEAP and
+//					the binary heap for every other strategy
+template <bool TRACK_PATHS, class Store>
+void Graph::searchRowsAlong(const vector<int>& sources, bool reverse, const Store& store) const {
+	bool radix = queueStrategy == RADIX_HEAP;
+	if (!reverse && smallAdjacency.builtFrom(adjacency)) {
+		if (radix) {
+			searchRows<TRACK_PATHS, SmallAdjacency, RadixQueue<uint16_t>>(sources, smallAdjacency, store);
+		}
+		else {
+			searchRows<TRACK_PATHS, SmallAdjacency, HeapQueue<uint16_t>>(sources, smallAdjacency, store);
+		}
+		return;
+	}
+	const CSRGraph& edges = reverse ? reverseAdjacency : adjacency;
+	if (radix) {
+		searchRows<TRACK_PATHS, CSRGraph, RadixQueue<int>>(sources, edges, store);
+	}
+	else {
+		searchRows<TRACK_PATHS, CSRGraph, HeapQueue<int>>(sources, edges, store);
+	}
+}
+
+
+//---------------------------  findShortestPathDelta  ------------------------------
+//	Finds the shortest paths from a source vertex by delta stepping. vertices are
+//	kept in buckets of distances delta wide, and each bucket is settled by
+//	relaxing the light edges of its vertices until it stays empty, then their
+//	heavy edges once
+//	Preconditions:	the value being passed in as a parameter to the function is an 
+//					integer. the private member Table T has been initialized.
+//	Postconditions:	row source of Table T holds the shortest distance and a
+//					shortest path from source to every vertex that can be reached.
+//					delta is the mean edge weight, and the edges of a bucket are
+//					relaxed on up to threadCount workers, one for every EDGE_GRAIN
+//					edges
+//					the counts of the search are added to stats
+void Graph::findShortestPathDelta(int source, SearchStats& stats) {
+	TableRow& row = T[source];
+	row.dist[source] = 0;
+	row.path[source] = source;
+
+	// edges no heavier than delta are light, and can land back in the bucket
+	// that is being settled
+	long long totalWeight = 0;
+	int heaviest = 0;
+	for (int edge = 0; edge < adjacency.edgeCount(); edge++) {
+		totalWeight += adjacency.weightAt(edge);
+		heaviest = max(heaviest, adjacency.weightAt(edge));
+	}
+	Distance delta = 1;
+	if (adjacency.edgeCount() > 0 && totalWeight / adjacency.edgeCount() > 1) {
+		delta = static_cast<Distance>(totalWeight / adjacency.edgeCount());
+	}
+
+	// every tentative distance is less than one heaviest edge past the bucket
+	// being settled, so the buckets are reused in a cycle
+	vector<vector<int>> buckets(heaviest / delta + 2);
+	size_t waiting = 0;
+	auto place = [&](int vertex) {
+		buckets[(row.dist[vertex] / delta) % buckets.size()].push_back(vertex);
+		waiting++;
+		SEARCH_COUNT(stats, heapPushes, 1);
+	};
+
+	// a relaxation found by a worker, applied after all the workers are done
+	struct Relaxation {
+		int vertex;
+		Distance dist;
+		int from;
+	};
+	// a worker is only worth waking for this many edges, smaller batches are
+	// relaxed in place on the calling thread
+	const long long EDGE_GRAIN = 16384;
+	int workers = resolveThreadCount(threadCount);
+	auto relax = [&](const vector<int>& from, bool light) {
+		long long work = 0;
+		for (int vertex : from) {
+			work += adjacency.rowEnd(vertex) - adjacency.rowBegin(vertex);
+		}
+		SEARCH_COUNT(stats, edgesScanned, work);
+		int chunks = static_cast<int>(min(static_cast<long long>(workers), work / EDGE_GRAIN));
+		if (chunks <= 1) {
+			for (int vertex : from) {
+				for (int edge = adjacency.rowBegin(vertex); edge < adjacency.rowEnd(vertex); edge++) {
+					int weight = adjacency.weightAt(edge);
+					int adjacent = adjacency.adjVertexAt(edge);
+					Distance newDist = row.dist[vertex] + weight;
+					if ((weight <= delta) == light && newDist < row.dist[adjacent]) {
+						row.dist[adjacent] = newDist;
+						row.path[adjacent] = vertex;
+						place(adjacent);
+						SEARCH_COUNT(stats, relaxed, 1);
+					}
+				}
+			}
+			return;
+		}
+		// the workers only read the row, each writes its own list
+		vector<vector<Relaxation>> found(chunks);
+		parallelFor(0, chunks, chunks, [&](int chunk) {
+			size_t first = from.size() * chunk / chunks;
+			size_t last = from.size() * (chunk + 1) / chunks;
+			for (size_t i = first; i < last; i++) {
+				int vertex = from[i];
+				for (int edge = adjacency.rowBegin(vertex); edge < adjacency.rowEnd(vertex); edge++) {
+					int weight = adjacency.weightAt(edge);
+					Distance newDist = row.dist[vertex] + weight;
+					if ((weight <= delta) == light && newDist < row.dist[adjacency.adjVertexAt(edge)]) {
+						found[chunk].push_back(Relaxation{ adjacency.adjVertexAt(edge), newDist, vertex });
+					}
+				}
+			}
+		});
+		for (const vector<Relaxation>& list : found) {
+			for (const Relaxation& relaxation : list) {
+				if (relaxation.dist < row.dist[relaxation.vertex]) {
+					row.dist[relaxation.vertex] = relaxation.dist;
+					row.path[relaxation.vertex] = relaxation.from;
+					place(relaxation.vertex);
+					SEARCH_COUNT(stats, relaxed, 1);
+				}
+			}
+		}
+	};
+
+	// batch[v] is the last batch v was taken in and settledIn[v] the last bucket,
+	// so a vertex listed twice is only relaxed once per batch and once per bucket
+	vector<long long> batch(size + 1, -1);
+	vector<long long> settledIn(size + 1, -1);
+	long long batches = 0;
+	place(source);
+	for (long long bucket = 0; waiting > 0; bucket++) {
+		vector<int>& slot = buckets[bucket % buckets.size()];
+		vector<int> settled;
+		while (!slot.empty()) {
+			vector<int> current;
+			current.swap(slot);
+			waiting -= current.size();
+			batches++;
+
+			// a vertex that has moved to an earlier bucket since it was placed
+			// has already been settled there
+			vector<int> live;
+			for (int vertex : current) {
+				if (row.dist[vertex] / delta == bucket && batch[vertex] != batches) {
+					batch[vertex] = batches;
+					live.push_back(vertex);
+					if (settledIn[vertex] != bucket) {
+						settledIn[vertex] = bucket;
+						settled.push_back(vertex);
+						row.markVisited(vertex);
+						SEARCH_COUNT(stats, settled, 1);
+					}
+				}
+			}
+			relax(live, true);
+		}
+		// heavy edges always land in a later bucket, so they are relaxed once
+		relax(settled, false);
+	}
+}
+
+
+//--------------------------------  useHeap  --------------------------------------
+//	Decides whether the binary heap or a scan of the row is used for this graph
+//	Preconditions:	size and edgeCount are up to date
+//	Postconditions:	true is returned if the heap should be used. for AUTO_QUEUE the
+//					heap is used while E * log2(V) is less than V * V
+bool Graph::useHeap() const {
+	if (queueStrategy == LINEAR_SCAN || queueStrategy == VECTOR_SCAN) {
+		return false;
+	}
+	if (queueStrategy == BINARY_HEAP) {
+		return true;
+	}
+	double vertexCount = size > 1 ? size : 2;
+	return edgeCount * log2(vertexCount) < vertexCount * vertexCount;
+}
+
+
+//----------------------------  sourceThreadCount  --------------------------------
+//	Returns how many workers the source vertices are spread over
+//	Preconditions:	none
+//	Postconditions:	threadCount is returned, or 1 with DELTA_STEPPING, which uses
+//					the workers inside each source
+int Graph::sourceThreadCount() const {
+	return queueStrategy == DELTA_STEPPING ? 1 : threadCount;
+}
+
+
+//-----------------------------  setQueueStrategy  ---------------------------------
+//	Sets how findShortestPath picks the next vertex to visit
+//	Preconditions:	strategy is one of the QueueStrategy values
+//	Postconditions:	later calls to findShortestPath use strategy. AUTO_QUEUE picks
+//					the binary heap unless the graph is dense enough that a scan
+//					of the row is cheaper, and then picks the vectorized scan.
+//					RADIX_HEAP and DELTA_STEPPING give the same distances as the
+//					others, but a path may be another path of the same length
+void Graph::setQueueStrategy(QueueStrategy strategy) {
+	queueStrategy = strategy;
+}
+
+
+//-----------------------------  getQueueStrategy  ---------------------------------
+//	Returns the strategy that was set with setQueueStrategy
+//	Preconditions:	none
+//	Postconditions:	the current strategy is returned. graph object is not changed
+Graph::QueueStrategy Graph::getQueueStrategy() const {
+	return queueStrategy;
+}
+
+
+//------------------------------  setThreadCount  ----------------------------------
+//	Sets how many worker threads findShortestPath spreads the source vertices over
+//	Preconditions:	threadCount is greater than or equal to 0
+//	Postconditions:	later calls to findShortestPath use threadCount workers, or one
+//					per hardware thread if threadCount is 0. the default is 1, which
+//					computes every source on the calling thread. with DELTA_STEPPING
+//					the sources are computed one at a time and the workers share
+//					the relaxations of each source instead
+void Graph::setThreadCount(int threadCount) {
+	this->threadCount = threadCount < 0 ? 1 : threadCount;
+}
+
+
+//------------------------------  getThreadCount  ----------------------------------
+//	Returns the thread count that was set with setThreadCount
+//	Preconditions:	none
+//	Postconditions:	the thread count is returned. graph object is not changed
+int Graph::getThreadCount() const {
+	return threadCount;
+}
+
+
+//---------------------------  setIncrementalRepair  --------------------------------
+//	Sets whether inserting or removing an edge repairs the cached rows of Table T
+//	Preconditions:	none
+//	Postconditions:	while repair is true, a change to an edge keeps the cached rows.
+//					a shorter edge is propagated from its destination through the rows
+//					it improves, and a longer or removed edge empties only the rows
+//					whose shortest path tree uses it. the distances match a full
+//					recompute, but a path may be another path of the same length.
+//					the default is false, which empties every row on any change
+void Graph::setIncrementalRepair(bool repair) {
+	incrementalRepair = repair;
+}
+
+
+//---------------------------  getIncrementalRepair  --------------------------------
+//	Returns the setting that was set with setIncrementalRepair
+//	Preconditions:	none
+//	Postconditions:	the setting is returned. graph object is not changed
+bool Graph::getIncrementalRepair() const {
+	return incrementalRepair;
+}
+
+
+//-----------------------------  setTraceCallback  ---------------------------------
+//	Sets the function that is called after each table row and single query
+//	Preconditions:	the callback is not changed while queries run on other threads
+//	Postconditions:	when built with DIJKSTRA_STATS, callback is called with the kind,
+//					the ends and the counters of every row of Table T computed and
+//					every single query answered from then on. an empty callback
+//					turns the tracing off. without DIJKSTRA_STATS it is never called
+void Graph::setTraceCallback(TraceCallback callback) {
+	traceCallback = move(callback);
+}
+
+
+//------------------------------  getSearchStats  ----------------------------------
+//	Returns the counters of every search since the graph was made or they were reset
+//	Preconditions:	none
+//	Postconditions:	the sums of the counters and times of the rows and single
+//					queries are returned, all 0 without DIJKSTRA_STATS. graph object
+//					is not changed
+SearchStats Graph::getSearchStats() const {
+	lock_guard<mutex> guard(statsLock);
+	return totalStats;
+}
+
+
+//-----------------------------  resetSearchStats  ---------------------------------
+//	Sets the counters getSearchStats returns back to 0
+//	Preconditions:	none
+//	Postconditions:	every counter and time of the totals is 0
+void Graph::resetSearchStats() {
+	lock_guard<mutex> guard(statsLock);
+	totalStats.clear();
+}
+
+
+//-------------------------------  recordSearch  ----------------------------------
+//	Adds what one search did to the totals and hands it to the trace callback
+//	Preconditions:	trace holds the counters of a search that has finished
+//	Postconditions:	the counters of trace are added to totalStats, and traceCallback
+//					is called with trace if it is set
+void Graph::recordSearch(const QueryTrace& trace) const {
+	{
+		lock_guard<mutex> guard(statsLock);
+		totalStats += trace.stats;
+	}
+	// called outside the lock, so a slow callback only holds up its own thread
+	if (traceCallback) {
+		traceCallback(trace);
+	}
+}
+
+
+//----------------------------  setSharedTopology  ---------------------------------
+//	Sets whether copies of the graph share its edges instead of copying them
+//	Preconditions:	none
+//	Postconditions:	while shared is true, the copy constructor and assignment
+//					operator share the compressed adjacency of this graph with the
+//					copy, and the copy builds its own adjacency lists the first time
+//					an edge of it is inserted or removed. the copy starts with no
+//					cached rows of Table T. copies keep the setting. the default is
+//					false, which makes a deep copy
+void Graph::setSharedTopology(bool shared) {
+	sharedTopology = shared;
+}
+
+
+//----------------------------  getSharedTopology  ---------------------------------
+//	Returns the setting that was set with setSharedTopology
+//	Preconditions:	none
+//	Postconditions:	the setting is returned. graph object is not changed
+bool Graph::getSharedTopology() const {
+	return sharedTopology;
+}
+
+
+//------------------------------  getVertexCount  ----------------------------------
+//	Returns the number of vertices in the graph
+//	Preconditions:	none
+//	Postconditions:	the number of vertices is returned, they are numbered 1 to it.
+//					graph object is not changed
+int Graph::getVertexCount() const {
+	return size;
+}
+
+
+//-------------------------------  getEdgeCount  -----------------------------------
+//	Returns the number of edges in the graph
+//	Preconditions:	none
+//	Postconditions:	the number of edges is returned. graph object is not changed
+int Graph::getEdgeCount() const {
+	return edgeCount;
+}
+
+
+//--------------------------------  findVertex  ------------------------------------
+//	Finds a vertex by its description
+//	Preconditions:	none
+//	Postconditions:	the subscript of the vertex whose description is the same as
+//					description is returned, or 0 if there is none. graph object is
+//					not changed
+int Graph::findVertex(const string& description) const {
+	if (descriptions == nullptr) {
+		return 0;
+	}
+	int vertex = descriptions->find(description);
+	return vertex > 0 ? vertex : 0;
+}
+
+
+//----------------------------  lowestWeightVertex  --------------------------------
+//	A helper method that finds the next lowest weight vertex that has not been 
+//	visited yet
+//	Preconditions:	the parameter passed in is an integer. the private data member 
+//					of the calling Graph object, Table T, has been being kept updated
+//					by the findShortestPath algorithm.
+//	Postconditions: no changes made to the Graph object. the vertex that has not been
+//					visited and has the lowest weight is returned to the calling
+//					object. If no vertex is found, then 0 is returned. the entries
+//					read are counted in stats
+int Graph::lowestWeightVertex(int source, SearchStats& stats) const {
+	// only the distances and the visited bits are read
+	const TableRow& row = T[source];
+	Distance lowestWeight = NO_DISTANCE;
+	int returnVertex = 0;
+	for (int i = 1; i <= size; i++) {
+		if (row.dist[i] < lowestWeight && !row.isVisited(i)) {
+			lowestWeight = row.dist[i];
+			returnVertex = i;
+		}
+	}
+	SEARCH_COUNT(stats, scanned, size);
+	return returnVertex;
+}
+
+
+//----------------------------------  displayAll  ----------------------------------
+//	Displays the shortest path from all vertices in the graph to all vertices in
+//	the graph
+//	Preconditions:	the private data member of Graph, Table T, is accurate and up to
+//					data. every vertex has a description
+//	Postconditions:	the findShortestPath function is called to update the 
+//					private data member Table T. for each vertex, all data from the 
+//					vertex to a destination vertex is printed in a table format. the 
+//					source vertex, destination vertex, distance travelled, and path
+//					travelled are printed in a table format.
+void Graph::displayAll() {
+	// the table is formatted into one buffer and written to cout in large pieces
+	writeReport(cout, ReportWriter::TEXT);
+}
+
+
+//---------------------------------  displayAll  -----------------------------------
+//	Displays the shortest path from every vertex to every other vertex, searching in
+//	a workspace the caller keeps
+//	Preconditions:	the graph is not changed while the call runs. workspace is not
+//					used by another call at the same time
+//	Postconditions:	the same table as displayAll without a workspace is printed.
+//					Table T is not used or changed
+void Graph::displayAll(QueryWorkspace& workspace) const {
+	ReportWriter writer(cout, ReportWriter::TEXT);
+	writeReport(writer, workspace);
+}
+
+
+//---------------------------------  writeReport  ----------------------------------
+//	Writes the shortest path from every vertex to every other vertex to a report
+//	Preconditions:	none
+//	Postconditions:	the findShortestPath function is called to update Table T. for
+//					each source vertex a row is written for every other vertex, with
+//					the path rebuilt from the previous vertices in Table T. the
+//					writer is flushed. true is returned if everything was written
+bool Graph::writeReport(ReportWriter& writer) {
+	// Update graph by calling findShortestPath
 	findShortestPath();
-	
+
+	writer.beginReport(size);
+	vector<int> hops;
+	for (int i = 1; i <= size; i++) {
+		writer.beginSource(i, descriptions->description(i));
+		for (int j = 1; j <= size; j++) {
+			if (i != j) {
+				// hops keeps its storage from row to row
+				hops.resize(tracePath(i, j, nullptr, 0));
+				tracePath(i, j, hops.data(), static_cast<int>(hops.size()));
+				writer.writeRow(i, j, T[i].dist[j], hops);
+			}
+		}
+		writer.endSource();
+	}
+	return writer.flush();
+}
+
+
+//---------------------------------  writeReport  ----------------------------------
+//	Writes the shortest path from every vertex to every other vertex to a report,
+//	searching in a workspace the caller keeps
+//	Preconditions:	the graph is not changed while the call runs. workspace is not
+//					used by another call at the same time
+//	Postconditions:	the same rows as writeReport without a workspace are written, from
+//					one search per source run in workspace. Table T is not used or
+//					changed. the writer is flushed. true is returned if everything
+//					was written
+bool Graph::writeReport(ReportWriter& writer, QueryWorkspace& workspace) const {
+	freezeAdjacency();
+	writer.beginReport(size);
+	vector<int> hops;
+	for (int i = 1; i <= size; i++) {
+		workspace.prepare(size);
+		SearchState& state = workspace.forward;
+		searchFrom(i, 0, state);
+		writer.beginSource(i, descriptions->description(i));
+		for (int j = 1; j <= size; j++) {
+			if (i != j) {
+				// hops keeps its storage from row to row
+				traceLinks(state, i, j, hops);
+				writer.writeRow(i, j, state.dist(j), hops);
+			}
+		}
+		writer.endSource();
+	}
+	return writer.flush();
+}
+
+
+//---------------------------------  writeReport  ----------------------------------
+//	Writes the shortest path report to a stream in the given format
+//	Preconditions:	out is open for writing
+//	Postconditions:	the report is written through a buffered ReportWriter. true is
+//					returned if everything was written
+bool Graph::writeReport(ostream& out, ReportWriter::Format format) {
+	ReportWriter writer(out, format);
+	return writeReport(writer);
+}
+
+
+//---------------------------------  writeReport  ----------------------------------
+//	Writes the shortest path report to a file descriptor in the given format
+//	Preconditions:	fileDescriptor is open for writing
+//	Postconditions:	the report is written through a buffered ReportWriter. true is
+//					returned if everything was written. fileDescriptor is not closed
+bool Graph::writeReport(int fileDescriptor, ReportWriter::Format format) {
+	ReportWriter writer(fileDescriptor, format);
+	return writeReport(writer);
+}
+
+
+//----------------------------  printPath  -------------------------------------------
+//	A helper method that prints the path from a source vertex to a destination vertex
+//	Preconditions:	path holds the vertices of a path in order of travel, or is empty
+//					if there is no path
+//	Postconditions:	each vertex of the path is printed in order of travel, resulting
+//					in a path from a source vertex to a destination vertex. graph
+//					object is not changed.
+void Graph::printPath(const vector<int>& path) const {
+	// IF there is no path, the loop prints nothing
+	for (int vertex : path) {
+		cout << " " << vertex;
+	}
+}
+
+
+//--------------------------------  tracePath  ------------------------------------
+//	Rebuilds a path from the previous vertices in a row of Table T, without recursion
+//	Preconditions:	buffer holds capacity ints
+//	Postconditions:	the number of vertices from source to destination is returned,
+//					0 if there is no path, either vertex is not in the graph or row
+//					source of Table T is not cached. if it is no more than capacity,
+//					buffer holds the path in order of travel. graph object is not
+//					changed
+int Graph::tracePath(int source, int destination, int* buffer, int capacity) const {
+	if (!isVertex(source) || !isVertex(destination) ||
+		static_cast<size_t>(source) >= T.size() || T[source].empty()) {
+		return 0;
+	}
+	const vector<int>& previous = T[source].path;
+	// a path of 0 means there is no path
+	if (previous[destination] <= 0) {
+		return 0;
+	}
+
+	// count the vertices first so they can be stored from the back, in travel order
+	int length = 1;
+	for (int vertex = destination; vertex != source; vertex = previous[vertex]) {
+		length++;
+	}
+	if (length <= capacity) {
+		int slot = length - 1;
+		for (int vertex = destination; vertex != source; vertex = previous[vertex]) {
+			buffer[slot--] = vertex;
+		}
+		buffer[0] = source;
+	}
+	return length;
+}
+
+
+//------------------------------------  display  -----------------------------------
+//	Displays a single, detailed path from a source vertex to a destination vertex
+//	Preconditions:	the parameters passed in are integer values. every vertex has a 
+//					description
+//	Postconditions:	the row of Table T for source is computed if it is not cached
+//					already. The specific data from the requested
+//					source vertex to destination vertex is printed including the 
+//					source vertex, destination vertex, distance travelled, exact path,
+//					and the name of the vertex. if either vertex is not in the graph,
+//					only the line with -- for the distance is printed, as for a
+//					destination that cannot be reached
+void Graph::display(int source, int destination) {
+	// a vertex that is not in the graph has no path, so only its line is printed
+	if (!isVertex(source) || !isVertex(destination)) {
+		printDetails(source, destination, NO_DISTANCE, vector<int>());
+		return;
+	}
+	// only the paths from source are needed
+	prepareTable();
+	computeRow(source);
+
+	vector<int> path(tracePath(source, destination, nullptr, 0));
+	tracePath(source, destination, path.data(), static_cast<int>(path.size()));
+	printDetails(source, destination, T[source].dist[destination], path);
+}
+
+
+//------------------------------------  display  -----------------------------------
+//	Displays a single, detailed path from a source vertex to a destination vertex,
+//	searching in a workspace the caller keeps
+//	Preconditions:	the graph is not changed while the call runs. workspace is not
+//					used by another call at the same time
+//	Postconditions:	the same lines as display without a workspace are printed. Table
+//					T is not used, so many threads can display paths of one graph at
+//					once, each with its own workspace
+void Graph::display(int source, int destination, QueryWorkspace& workspace) const {
+	PathResult result = shortestPath(source, destination, workspace);
+	printDetails(source, destination, result.distance, result.path);
+}
+
+
+//---------------------------------  printDetails  ---------------------------------
+//	Prints the line and the descriptions of a single path, the way display lays it out
+//	Preconditions:	path holds the vertices from source to destination, or is empty
+//					if distance is NO_DISTANCE
+//	Postconditions:	the source vertex, destination vertex, distance and path are
+//					printed on one line and the description of each vertex of the path
+//					on the lines after it. graph object is not changed
+void Graph::printDetails(int source, int destination, Distance distance, 
+	const vector<int>& path) const {
 	cout << source;
 	cout << setw(6) << destination;
-	if (T[source][destination].dist < INT_MAX) {
-		cout << setw(6) << T[source][destination].dist;
+	if (distance < NO_DISTANCE) {
+		cout << setw(6) << distance;
 	}
 	else {
 		cout << setw(6) << "--";
 	}
 
 	cout << setw(6);
-	printPath(source, destination);
+	printPath(path);
 	cout << endl;
-	printLocationDescriptions(source, destination);
+	printLocationDescriptions(path);
+}
+
+
+//---------------------------------  shortestPath  ---------------------------------
+//	Finds the shortest path from a source vertex to a destination vertex
+//	Preconditions:	none
+//	Postconditions:	a single search is ran from source and stopped as soon as 
+//					destination is settled. the distance, the path from source to 
+//					destination and the number of vertices settled are returned. if
+//					there is no path, or either vertex is not in the graph, the
+//					distance is NO_DISTANCE and the path is empty. Table T is not changed.
+//					with BIDIRECTIONAL a backward search from destination runs too, and
+//					settled counts the vertices settled by both searches. the search
+//					works in a workspace the graph keeps from one query to the next
+Graph::PathResult Graph::shortestPath(int source, int destination, SearchDirection direction) {
+	return shortestPath(source, destination, workspace, direction);
+}
+
+
+//---------------------------------  shortestPath  ---------------------------------
+//	Finds the shortest path from a source vertex to a destination vertex in a
+//	workspace the caller keeps
+//	Preconditions:	none
+//	Postconditions:	the same result as shortestPath without a workspace is returned.
+//					the search only writes the vertices it reaches in workspace, so
+//					the cost of the query does not grow with the size of the graph
+Graph::PathResult Graph::shortestPath(int source, int destination, QueryWorkspace& workspace,
+	SearchDirection direction) const {
+	if (!isVertex(source) || !isVertex(destination)) {
+		PathResult result;
+		result.distance = NO_DISTANCE;
+		result.settled = 0;
+		return result;
+	}
+	SEARCH_CLOCK(setupStart);
+	freezeAdjacency();
+	workspace.prepare(size);
+	SEARCH_PHASE(workspace.forward.stats, setupNanoseconds, setupStart);
+
+	PathResult result = direction == BIDIRECTIONAL ? bidirectionalSearch(source, destination, workspace)
+		: unidirectionalSearch(source, destination, workspace);
+#ifdef DIJKSTRA_STATS
+	QueryTrace trace = { direction == BIDIRECTIONAL ? BIDIRECTIONAL_QUERY : UNIDIRECTIONAL_QUERY,
+		source, destination, workspace.forward.stats };
+	trace.stats += workspace.backward.stats;
+	recordSearch(trace);
+#endif
+	return result;
+}
+
+
+//----------------------------  unidirectionalSearch  ------------------------------
+//	Finds the shortest path from source to destination with one search that stops
+//	once destination is settled
+//	Preconditions:	source and destination are vertices in the graph. adjacency is
+//					up to date. workspace has been prepared for size vertices
+//	Postconditions:	the distance, the path and the number of vertices settled are
+//					returned. graph object is not changed
+Graph::PathResult Graph::unidirectionalSearch(int source, int destination, 
+	QueryWorkspace& workspace) const {
+	PathResult result;
+	SearchState& state = workspace.forward;
+	SEARCH_CLOCK(searchStart);
+	result.settled = searchFrom(source, destination, state);
+	result.distance = state.dist(destination);
+	SEARCH_PHASE(state.stats, searchNanoseconds, searchStart);
+
+	SEARCH_CLOCK(traceStart);
+	traceLinks(state, source, destination, result.path);
+	SEARCH_PHASE(state.stats, traceNanoseconds, traceStart);
+	return result;
 }
 
 
-//------------------------  printLocationDescriptions  -----------------------------------
-//	A helper method that recursively finds the path location descriptions from a 
-//	source vertex to a destination vertex
-//	Preconditions:	the parameters passed in are integer values. all vertex pointers
-//					in vertexNode point to a vertex object. Table T is updated
-//	Postconditions:	the destination path is travelled recursively and once done, prints
-//					vertex data in recursive fashion. this results in a detailed path
-//					description printed in order of travel. graph object is not changed
-void Graph::printLocationDescriptions(const int& source, const int& destination) const {
-	// IF path is 0, skip loop and do not print anything (there is no path)
-	if (T[source][destination].path > 0) {
-		if (source != destination) {
-			printLocationDescriptions(source, T[source][destination].path);
+//---------------------------------  searchFrom  -----------------------------------
+//	Runs Dijkstra's Algorithm from a source vertex in a search state
+//	Preconditions:	source is a vertex in the graph. adjacency is up to date. state
+//					has been prepared for size vertices
+//	Postconditions:	vertices are settled in order of distance until destination is
+//					settled, or every vertex source reaches if destination is 0. state
+//					holds the distance and previous vertex of each vertex reached. the
+//					number of vertices settled is returned. graph object is not changed
+int Graph::searchFrom(int source, int destination, SearchState& state) const {
+	int settled = 0;
+	IndexedHeap& frontier = state.frontier();
+	state.reach(source, 0, source);
+	frontier.push(source, 0);
+	SEARCH_COUNT(state.stats, heapPushes, 1);
+
+	while (!frontier.isEmpty()) {
+		int vertex = frontier.popMin();
+		state.markSettled(vertex);
+		settled++;
+
+		// the distance of a settled vertex is final, nothing further is needed
+		if (vertex == destination) {
+			break;
+		}
+		relaxEdges(vertex, state);
+	}
+	SEARCH_COUNT(state.stats, settled, settled);
+	return settled;
+}
+
+
+//-----------------------------  searchFromSources  --------------------------------
+//	Runs Dijkstra's Algorithm from several source vertices at once in a search state
+//	Preconditions:	adjacency is up to date. state has been prepared for size
+//					vertices. targets is sorted and holds no vertex twice
+//	Postconditions:	each source in the graph with an offset of 0 or more is reached
+//					at its offset, as its own previous vertex. vertices are settled in
+//					order of distance until every vertex of targets is settled, or
+//					until the frontier holds nothing within limit if targets is
+//					empty. if settledOrder is not nullptr, each vertex settled is
+//					added to it with its distance. the number of vertices settled is
+//					returned. graph object is not changed
+int Graph::searchFromSources(const vector<SearchSource>& sources, const vector<int>& targets,
+	Distance limit, SearchState& state, vector<VertexDistance>* settledOrder) const {
+	int settled = 0;
+	IndexedHeap& frontier = state.frontier();
+
+	// every source is on the frontier before the first vertex is settled. a source
+	// listed more than once keeps its lowest offset
+	for (const SearchSource& start : sources) {
+		if (!isVertex(start.vertex) || start.offset < 0 || start.offset >= state.dist(start.vertex)) {
+			continue;
+		}
+		state.reach(start.vertex, start.offset, start.vertex);
+		if (frontier.contains(start.vertex)) {
+			frontier.decreaseKey(start.vertex, start.offset);
+			SEARCH_COUNT(state.stats, heapDecreases, 1);
+		}
+		else {
+			frontier.push(start.vertex, start.offset);
+			SEARCH_COUNT(state.stats, heapPushes, 1);
+		}
+	}
+
+	int targetsLeft = static_cast<int>(targets.size());
+	while (!frontier.isEmpty() && frontier.minKey() <= limit) {
+		int vertex = frontier.popMin();
+		state.markSettled(vertex);
+		settled++;
+		if (settledOrder != nullptr) {
+			settledOrder->push_back(VertexDistance{ vertex, state.dist(vertex) });
+		}
+
+		// once the last target is settled nothing further is needed
+		if (targetsLeft > 0 && binary_search(targets.begin(), targets.end(), vertex) &&
+			--targetsLeft == 0) {
+			break;
+		}
+		relaxEdges(vertex, state);
+	}
+	SEARCH_COUNT(state.stats, settled, settled);
+	return settled;
+}
+
+
+//---------------------------------  relaxEdges  -----------------------------------
+//	Relaxes the edges leaving a settled vertex of a search
+//	Preconditions:	vertex has just been settled in state. adjacency is up to date
+//	Postconditions:	every vertex adjacent to vertex that is not settled and gets a
+//					shorter distance through it is reached from vertex and is on the
+//					frontier of state with that distance
+void Graph::relaxEdges(int vertex, SearchState& state) const {
+	IndexedHeap& frontier = state.frontier();
+	SEARCH_COUNT(state.stats, edgesScanned, adjacency.rowEnd(vertex) - adjacency.rowBegin(vertex));
+	for (int edge = adjacency.rowBegin(vertex); edge < adjacency.rowEnd(vertex); edge++) {
+		int adjacent = adjacency.adjVertexAt(edge);
+		Distance newDist = state.dist(vertex) + adjacency.weightAt(edge);
+		if (!state.isSettled(adjacent) && state.dist(adjacent) > newDist) {
+			state.reach(adjacent, newDist, vertex);
+			SEARCH_COUNT(state.stats, relaxed, 1);
+			if (frontier.contains(adjacent)) {
+				frontier.decreaseKey(adjacent, newDist);
+				SEARCH_COUNT(state.stats, heapDecreases, 1);
+			}
+			else {
+				frontier.push(adjacent, newDist);
+				SEARCH_COUNT(state.stats, heapPushes, 1);
+			}
+		}
+	}
+}
+
+
+//---------------------------------  traceLinks  -----------------------------------
+//	Rebuilds a path from the previous vertices of a search state, without recursion
+//	Preconditions:	state holds a search from source
+//	Postconditions:	path holds the vertices from source to destination in order of
+//					travel, or is empty if state has not reached destination
+void Graph::traceLinks(const SearchState& state, int source, int destination, vector<int>& path) {
+	path.clear();
+	if (state.dist(destination) == NO_DISTANCE) {
+		return;
+	}
+	// walk the predecessors back to source, then put them in travel order
+	for (int vertex = destination; vertex != source; vertex = state.link(vertex)) {
+		path.push_back(vertex);
+	}
+	path.push_back(source);
+	reverse(path.begin(), path.end());
+}
+
+
+//--------------------------------  traceToRoot  -----------------------------------
+//	Rebuilds a path from the previous vertices of a search started from several
+//	sources, back to the source it came from
+//	Preconditions:	each source of the search in state is its own previous vertex
+//	Postconditions:	path holds the vertices from the source destination was reached
+//					from to destination in order of travel, or is empty if state has
+//					not reached destination
+void Graph::traceToRoot(const SearchState& state, int destination, vector<int>& path) {
+	path.clear();
+	if (state.dist(destination) == NO_DISTANCE) {
+		return;
+	}
+	// only a source is its own previous vertex
+	int vertex = destination;
+	for (; state.link(vertex) != vertex; vertex = state.link(vertex)) {
+		path.push_back(vertex);
+	}
+	path.push_back(vertex);
+	reverse(path.begin(), path.end());
+}
+
+
+//----------------------------------  getPath  -------------------------------------
+//	Returns the shortest path from a source vertex to a destination vertex
+//	Preconditions:	none
+//	Postconditions:	the row of Table T for source is computed if it is not cached
+//					already. the vertices from source to destination are returned in
+//					order of travel, or an empty vector if there is no path or either
+//					vertex is not in the graph. nothing is printed
+vector<int> Graph::getPath(int source, int destination) {
+	vector<int> path;
+	if (!isVertex(source) || !isVertex(destination)) {
+		return path;
+	}
+	prepareTable();
+	computeRow(source);
+
+	path.resize(tracePath(source, destination, nullptr, 0));
+	tracePath(source, destination, path.data(), static_cast<int>(path.size()));
+	return path;
+}
+
+
+//----------------------------------  getPath  -------------------------------------
+//	Fills a buffer the caller owns with the shortest path from a source vertex to a
+//	destination vertex
+//	Preconditions:	buffer holds capacity ints, or is nullptr if capacity is 0
+//	Postconditions:	the row of Table T for source is computed if it is not cached
+//					already. the number of vertices in the path is returned, 0 if
+//					there is no path or either vertex is not in the graph. if it is
+//					no more than capacity, buffer holds the path in order of travel,
+//					otherwise buffer is not changed
+int Graph::getPath(int source, int destination, int* buffer, int capacity) {
+	if (!isVertex(source) || !isVertex(destination)) {
+		return 0;
+	}
+	prepareTable();
+	computeRow(source);
+	return tracePath(source, destination, buffer, capacity);
+}
+
+
+//--------------------------------  shortestPaths  ---------------------------------
+//	Answers many source to destination queries at once
+//	Preconditions:	none
+//	Postconditions:	the queries are grouped by source, and the row of Table T for each
+//					distinct source is computed once if it is not cached already, on
+//					as many threads as setThreadCount allows. one result is returned
+//					per query, in the order of queries. settled is the number of
+//					vertices the run from that source settled. a query with a vertex
+//					that is not in the graph gets NO_DISTANCE and an empty path
+vector<Graph::PathResult> Graph::shortestPaths(const vector<PathQuery>& queries) {
+	prepareTable();
+
+	// each source that is asked about and not cached yet is computed once
+	vector<bool> wanted(size + 1, false);
+	vector<int> sources;
+	for (const PathQuery& query : queries) {
+		if (isVertex(query.source) && isVertex(query.destination) && !wanted[query.source]) {
+			wanted[query.source] = true;
+			if (T[query.source].empty()) {
+				sources.push_back(query.source);
+			}
+		}
+	}
+	// each source only writes its own row of T, so the rows are independent
+	parallelFor(0, static_cast<int>(sources.size()), sourceThreadCount(), [this, &sources](int i) {
+		computeRow(sources[i]);
+	});
+
+	// vertices a run settled are the ones it reached, counted once per source
+	vector<int> settled(size + 1, -1);
+	vector<PathResult> results(queries.size());
+	for (size_t i = 0; i < queries.size(); i++) {
+		int source = queries[i].source;
+		int destination = queries[i].destination;
+		PathResult& result = results[i];
+		result.distance = NO_DISTANCE;
+		result.settled = 0;
+		if (!isVertex(source) || !isVertex(destination)) {
+			continue;
+		}
+
+		if (settled[source] < 0) {
+			settled[source] = static_cast<int>(count_if(T[source].dist.begin() + 1, T[source].dist.end(),
+				[](Distance dist) { return dist < NO_DISTANCE; }));
+		}
+		result.settled = settled[source];
+		result.distance = T[source].dist[destination];
+		result.path.resize(tracePath(source, destination, nullptr, 0));
+		tracePath(source, destination, result.path.data(), static_cast<int>(result.path.size()));
+	}
+	return results;
+}
+
+
+//-----------------------------  shortestPathAStar  --------------------------------
+//	Finds the shortest path from a source vertex to a destination vertex with an A*
+//	search guided by a heuristic
+//	Preconditions:	heuristic never estimates more than the distance left to
+//					destination
+//	Postconditions:	vertices are settled in order of their distance from source plus
+//					their estimate, and the search stops as soon as destination is
+//					settled. the result is the same as shortestPath gives, with
+//					settled counting every vertex taken off the frontier. a vertex
+//					whose estimate is NO_DISTANCE is never entered. Table T is not changed
+Graph::PathResult Graph::shortestPathAStar(int source, int destination, const Heuristic& heuristic) {
+	return shortestPathAStar(source, destination, heuristic, workspace);
+}
+
+
+//-----------------------------  shortestPathAStar  --------------------------------
+//	Finds the shortest path from a source vertex to a destination vertex with an A*
+//	search guided by a heuristic, in a workspace the caller keeps
+//	Preconditions:	heuristic never estimates more than the distance left to
+//					destination
+//	Postconditions:	the same result as shortestPathAStar without a workspace is
+//					returned. the search only writes the vertices it reaches in
+//					workspace
+Graph::PathResult Graph::shortestPathAStar(int source, int destination, const Heuristic& heuristic,
+	QueryWorkspace& workspace) const {
+	if (!isVertex(source) || !isVertex(destination)) {
+		PathResult result;
+		result.distance = NO_DISTANCE;
+		result.settled = 0;
+		return result;
+	}
+	SEARCH_CLOCK(setupStart);
+	freezeAdjacency();
+	workspace.prepare(size);
+	SEARCH_PHASE(workspace.forward.stats, setupNanoseconds, setupStart);
+
+	PathResult result = aStarSearch(source, destination, heuristic, workspace);
+	SEARCH_STATS_ONLY(recordSearch(QueryTrace{ A_STAR_QUERY, source, destination, workspace.forward.stats }));
+	return result;
+}
+
+
+//---------------------------------  aStarSearch  ----------------------------------
+//	Finds the shortest path from source to destination with an A* search
+//	Preconditions:	source and destination are vertices in the graph. adjacency is
+//					up to date. workspace has been prepared for size vertices.
+//					heuristic never estimates more than the distance left
+//	Postconditions:	the distance, the path and the number of vertices taken off the
+//					frontier are returned. graph object is not changed
+Graph::PathResult Graph::aStarSearch(int source, int destination, const Heuristic& heuristic,
+	QueryWorkspace& workspace) const {
+	PathResult result;
+	result.distance = NO_DISTANCE;
+	result.settled = 0;
+
+	// the estimate of each vertex is asked for once
+	SearchState& state = workspace.forward;
+	IndexedHeap& frontier = state.frontier();
+	SEARCH_CLOCK(searchStart);
+	state.setEstimate(source, heuristic(source));
+	if (state.estimate(source) == NO_DISTANCE) {
+		SEARCH_PHASE(state.stats, searchNanoseconds, searchStart);
+		return result;
+	}
+	state.reach(source, 0, source);
+	frontier.push(source, state.estimate(source));
+	SEARCH_COUNT(state.stats, heapPushes, 1);
+
+	while (!frontier.isEmpty()) {
+		int vertex = frontier.popMin();
+		result.settled++;
+
+		// the estimate never overshoots, so nothing left can beat destination
+		if (vertex == destination) {
+			break;
+		}
+
+		SEARCH_COUNT(state.stats, edgesScanned, adjacency.rowEnd(vertex) - adjacency.rowBegin(vertex));
+		for (int edge = adjacency.rowBegin(vertex); edge < adjacency.rowEnd(vertex); edge++) {
+			int adjacent = adjacency.adjVertexAt(edge);
+			Distance newDist = state.dist(vertex) + adjacency.weightAt(edge);
+			if (state.dist(adjacent) <= newDist) {
+				continue;
+			}
+			if (!state.hasEstimate(adjacent)) {
+				state.setEstimate(adjacent, heuristic(adjacent));
+			}
+			if (state.estimate(adjacent) == NO_DISTANCE) {
+				continue;
+			}
+			state.reach(adjacent, newDist, vertex);
+			SEARCH_COUNT(state.stats, relaxed, 1);
+
+			// a heuristic that is not consistent can shorten the path to a vertex
+			// that was already settled, which puts it back on the frontier
+			long long key = static_cast<long long>(newDist) + state.estimate(adjacent);
+			Distance priority = key < NO_DISTANCE ? static_cast<Distance>(key) : NO_DISTANCE - 1;
+			if (frontier.contains(adjacent)) {
+				frontier.decreaseKey(adjacent, priority);
+				SEARCH_COUNT(state.stats, heapDecreases, 1);
+			}
+			else {
+				frontier.push(adjacent, priority);
+				SEARCH_COUNT(state.stats, heapPushes, 1);
+			}
+		}
+	}
+	SEARCH_COUNT(state.stats, settled, result.settled);
+	result.distance = state.dist(destination);
+	SEARCH_PHASE(state.stats, searchNanoseconds, searchStart);
+
+	SEARCH_CLOCK(traceStart);
+	traceLinks(state, source, destination, result.path);
+	SEARCH_PHASE(state.stats, traceNanoseconds, traceStart);
+	return result;
+}
+
+
+//--------------------------  shortestPathsFromSources  ----------------------------
+//	Finds the shortest path to each of a set of targets from the nearest of a set of
+//	sources, with one search
+//	Preconditions:	none
+//	Postconditions:	every source starts on the frontier at its offset, and the search
+//					stops as soon as every target is settled. one result is returned
+//					per target, in the order of targets, holding the distance from
+//					the nearest source with its offset and the path from that source.
+//					settled is the number of vertices the one search settled. a
+//					source that is not in the graph or has a negative offset is left
+//					out, and a target that is not in the graph or is not reached gets
+//					NO_DISTANCE and an empty path. with one source at offset 0 this
+//					is a one to many search. Table T is not changed
+vector<Graph::PathResult> Graph::shortestPathsFromSources(const vector<SearchSource>& sources,
+	const vector<int>& targets) {
+	return shortestPathsFromSources(sources, targets, workspace);
+}
+
+
+//--------------------------  shortestPathsFromSources  ----------------------------
+//	Finds the shortest path to each of a set of targets from the nearest of a set of
+//	sources, with one search in a workspace the caller keeps
+//	Preconditions:	the graph is not changed while the call runs. workspace is not
+//					used by another call at the same time
+//	Postconditions:	the same results as shortestPathsFromSources without a workspace
+//					are returned. workspace.forward holds the distances and previous
+//					vertices of the search
+vector<Graph::PathResult> Graph::shortestPathsFromSources(const vector<SearchSource>& sources,
+	const vector<int>& targets, QueryWorkspace& workspace) const {
+	vector<PathResult> results(targets.size());
+	for (PathResult& result : results) {
+		result.distance = NO_DISTANCE;
+		result.settled = 0;
+	}
+
+	// the search looks each settled vertex up in the targets, so they are sorted
+	vector<int> wanted;
+	for (int target : targets) {
+		if (isVertex(target)) {
+			wanted.push_back(target);
+		}
+	}
+	if (wanted.empty()) {
+		return results;
+	}
+	sort(wanted.begin(), wanted.end());
+	wanted.erase(unique(wanted.begin(), wanted.end()), wanted.end());
+
+	SEARCH_CLOCK(setupStart);
+	freezeAdjacency();
+	workspace.prepare(size);
+	SearchState& state = workspace.forward;
+	SEARCH_PHASE(state.stats, setupNanoseconds, setupStart);
+
+	SEARCH_CLOCK(searchStart);
+	int settled = searchFromSources(sources, wanted, NO_DISTANCE, state, nullptr);
+	SEARCH_PHASE(state.stats, searchNanoseconds, searchStart);
+
+	SEARCH_CLOCK(traceStart);
+	for (size_t i = 0; i < targets.size(); i++) {
+		if (isVertex(targets[i])) {
+			results[i].settled = settled;
+			results[i].distance = state.dist(targets[i]);
+			traceToRoot(state, targets[i], results[i].path);
+		}
+	}
+	SEARCH_PHASE(state.stats, traceNanoseconds, traceStart);
+#ifdef DIJKSTRA_STATS
+	QueryTrace trace = { MULTI_SOURCE_QUERY, sources.empty() ? 0 : sources[0].vertex, 0, state.stats };
+	recordSearch(trace);
+#endif
+	return results;
+}
+
+
+//-------------------------------  verticesWithin  ---------------------------------
+//	Finds every vertex within a distance of the nearest of a set of sources, with one
+//	search
+//	Preconditions:	none
+//	Postconditions:	every source starts on the frontier at its offset, and the search
+//					settles every vertex whose distance from the nearest source, with
+//					its offset, is no more than limit. those vertices are returned
+//					with their distances, in order of distance. a source that is not
+//					in the graph or has a negative offset is left out. Table T is not
+//					changed
+vector<Graph::VertexDistance> Graph::verticesWithin(const vector<SearchSource>& sources, Distance limit) {
+	return verticesWithin(sources, limit, workspace);
+}
+
+
+//-------------------------------  verticesWithin  ---------------------------------
+//	Finds every vertex within a distance of the nearest of a set of sources, with one
+//	search in a workspace the caller keeps
+//	Preconditions:	the graph is not changed while the call runs. workspace is not
+//					used by another call at the same time
+//	Postconditions:	the same vertices as verticesWithin without a workspace are
+//					returned. workspace.forward holds the distances and previous
+//					vertices of the search
+vector<Graph::VertexDistance> Graph::verticesWithin(const vector<SearchSource>& sources, Distance limit,
+	QueryWorkspace& workspace) const {
+	vector<VertexDistance> reached;
+	SEARCH_CLOCK(setupStart);
+	freezeAdjacency();
+	workspace.prepare(size);
+	SearchState& state = workspace.forward;
+	SEARCH_PHASE(state.stats, setupNanoseconds, setupStart);
+
+	// with no targets the search runs until the frontier holds nothing within limit
+	SEARCH_CLOCK(searchStart);
+	searchFromSources(sources, vector<int>(), limit, state, &reached);
+	SEARCH_PHASE(state.stats, searchNanoseconds, searchStart);
+#ifdef DIJKSTRA_STATS
+	QueryTrace trace = { MULTI_SOURCE_QUERY, sources.empty() ? 0 : sources[0].vertex, 0, state.stats };
+	recordSearch(trace);
+#endif
+	return reached;
+}
+
+
+//-------------------------------  zeroHeuristic  ----------------------------------
+//	Returns a heuristic that estimates 0 for every vertex
+//	Preconditions:	none
+//	Postconditions:	the heuristic is returned. with it shortestPathAStar settles the
+//					same vertices as a plain Dijkstra search
+Graph::Heuristic Graph::zeroHeuristic() {
+	return [](int) { return Distance(0); };
+}
+
+
+//----------------------------  euclideanHeuristic  --------------------------------
+//	Returns a heuristic that estimates the straight line distance to a destination
+//	Preconditions:	every edge is at least scale times as heavy as the straight line
+//					distance between the coordinates of its two vertices
+//	Postconditions:	the heuristic is returned. it estimates scale times the straight
+//					line distance from a vertex to destination, rounded down, and 0
+//					when either vertex has no coordinates. it keeps the coordinates
+//					the vertices have now
+Graph::Heuristic Graph::euclideanHeuristic(int destination, double scale) const {
+	if (!isVertex(destination) || locations == nullptr || !(*locations)[destination].located) {
+		return zeroHeuristic();
+	}
+	// holding the locations keeps the coordinates alive however long the
+	// heuristic is kept
+	shared_ptr<const vector<Location>> places = locations;
+	double x = (*places)[destination].x;
+	double y = (*places)[destination].y;
+	return [places, x, y, scale](int vertex) {
+		const Location& place = (*places)[vertex];
+		if (!place.located) {
+			return Distance(0);
 		}
-		cout << *vertices[destination].data << endl;
+		double estimate = floor(scale * hypot(place.x - x, place.y - y));
+		return estimate < static_cast<double>(NO_DISTANCE) ? static_cast<Distance>(estimate) 
+			: NO_DISTANCE - 1;
+	};
+}
+
+
+//-----------------------------  landmarkHeuristic  --------------------------------
+//	Returns a heuristic that estimates the distance to a destination from the
+//	distances to and from a set of landmarks
+//	Preconditions:	table was built by buildLandmarks and no edge has changed since
+//	Postconditions:	the heuristic is returned. it estimates the lower bound of the
+//					table from a vertex to destination, and holds on to the table
+Graph::Heuristic Graph::landmarkHeuristic(shared_ptr<const LandmarkTable> table, int destination) {
+	if (table == nullptr || destination < 0 || destination >= table->vertexCount()) {
+		return zeroHeuristic();
+	}
+	return [table, destination](int vertex) {
+		return table->lowerBound(vertex, destination);
+	};
+}
+
+
+//-------------------------------  buildLandmarks  ---------------------------------
+//	Computes the distances from and to a set of landmark vertices
+//	Preconditions:	every landmark is a vertex in the graph
+//	Postconditions:	a table is returned holding a search from each landmark along the
+//					edges and one along the reversed edges. a landmark that is not a
+//					vertex in the graph is skipped. Table T is not changed
+shared_ptr<LandmarkTable> Graph::buildLandmarks(const vector<int>& landmarks) {
+	freezeAdjacency();
+	prepareSmallAdjacency();
+	vector<int> chosen;
+	for (int landmark : landmarks) {
+		if (isVertex(landmark)) {
+			chosen.push_back(landmark);
+		}
+	}
+
+	// each landmark only writes its own slot of the table, so the landmarks are
+	// independent and can run on several threads. a row along the edges is kept
+	// until the row along the reversed edges of its landmark is done
+	shared_ptr<LandmarkTable> table = make_shared<LandmarkTable>();
+	table->reset(size + 1, chosen);
+	vector<vector<Distance>> fromDist(chosen.size());
+	searchRowsAlong<false>(chosen, false, [&fromDist](int i, const TableRow& row) {
+		fromDist[i] = row.dist;
+	});
+	searchRowsAlong<false>(chosen, true, [&fromDist, &table](int i, const TableRow& row) {
+		table->setDistances(i, fromDist[i], row.dist);
+		vector<Distance>().swap(fromDist[i]);
+	});
+	return table;
+}
+
+
+//-------------------------------  buildLandmarks  ---------------------------------
+//	Chooses a number of landmark vertices and computes the distances from and to them
+//	Preconditions:	count is greater than or equal to 0
+//	Postconditions:	landmarks are chosen one at a time, each the vertex farthest by
+//					round trip from the landmarks chosen before it, starting with the
+//					vertex farthest from vertex 1. a vertex no landmark reaches or is
+//					reached from counts as farthest. a table holding up to count
+//					landmarks is returned. Table T is not changed
+shared_ptr<LandmarkTable> Graph::buildLandmarks(int count) {
+	freezeAdjacency();
+	prepareSmallAdjacency();
+	vector<int> chosen;
+	vector<vector<Distance>> fromDist;
+	vector<vector<Distance>> toDist;
+	auto landmarkRow = [this](int source, bool reverse, vector<Distance>& dist) {
+		searchRowsAlong<false>(vector<int>(1, source), reverse, [&dist](int, const TableRow& row) {
+			dist = row.dist;
+		});
+	};
+
+	// nearest[v] is the shortest round trip from v to a chosen landmark, counting
+	// only the directions that have a path, LLONG_MAX while no landmark is tied to v
+	vector<long long> nearest(size + 1, LLONG_MAX);
+	int next = 0;
+	if (size > 0 && count > 0) {
+		vector<Distance> first;
+		landmarkRow(1, false, first);
+		next = 1;
+		for (int v = 2; v <= size; v++) {
+			if (first[v] < NO_DISTANCE && first[v] > first[next]) {
+				next = v;
+			}
+		}
+	}
+
+	while (next > 0 && static_cast<int>(chosen.size()) < count) {
+		chosen.push_back(next);
+		fromDist.emplace_back();
+		toDist.emplace_back();
+		landmarkRow(next, false, fromDist.back());
+		landmarkRow(next, true, toDist.back());
+
+		next = 0;
+		long long farthest = 0;
+		for (int v = 1; v <= size; v++) {
+			Distance out = toDist.back()[v];
+			Distance back = fromDist.back()[v];
+			if (out < NO_DISTANCE || back < NO_DISTANCE) {
+				long long trip = (out < NO_DISTANCE ? out : 0) + (back < NO_DISTANCE ? back : 0);
+				nearest[v] = min(nearest[v], trip);
+			}
+			// every vertex is a landmark already once the farthest is 0 away
+			if (nearest[v] > farthest) {
+				farthest = nearest[v];
+				next = v;
+			}
+		}
+	}
+
+	shared_ptr<LandmarkTable> table = make_shared<LandmarkTable>();
+	table->reset(size + 1, chosen);
+	for (int i = 0; i < static_cast<int>(chosen.size()); i++) {
+		table->setDistances(i, fromDist[i], toDist[i]);
+	}
+	return table;
+}
+
+
+//-------------------------------  saveLandmarks  ----------------------------------
+//	Writes a landmark table to a file, tagged with this graph's fingerprint
+//	Preconditions:	table was built from this graph and no edge has changed since
+//	Postconditions:	true is returned if the file was written, otherwise false
+bool Graph::saveLandmarks(const string& fileName, const LandmarkTable& table) const {
+	return table.save(fileName, fingerprint());
+}
+
+
+//-------------------------------  loadLandmarks  ----------------------------------
+//	Reads a landmark table that saveLandmarks wrote for this graph
+//	Preconditions:	none
+//	Postconditions:	the table is returned if the file holds one saved for a graph
+//					with the same fingerprint, so the preprocessing can be skipped.
+//					otherwise nullptr is returned
+shared_ptr<LandmarkTable> Graph::loadLandmarks(const string& fileName) const {
+	shared_ptr<LandmarkTable> table = make_shared<LandmarkTable>();
+	if (!table->load(fileName, fingerprint()) || table->vertexCount() != size + 1) {
+		return nullptr;
+	}
+	return table;
+}
+
+
+//-------------------------------  buildPathStore  ---------------------------------
+//	Computes the shortest paths from every vertex into a store with narrow cells
+//	Preconditions:	none
+//	Postconditions:	a store holding one row per vertex, with the distances and, for
+//					DISTANCES_AND_PATHS, the previous vertices, is returned. it is kept
+//					in memory if fileName is empty, otherwise in fileName mapped into
+//					memory. nullptr is returned if the file could not be made. Table T
+//					is not changed
+shared_ptr<PathStore> Graph::buildPathStore(PathStore::Contents contents, const string& fileName) {
+	vector<int> sources;
+	for (int v = 1; v <= size; v++) {
+		sources.push_back(v);
+	}
+	return buildPathStore(sources, contents, fileName);
+}
+
+
+//-------------------------------  buildPathStore  ---------------------------------
+//	Computes the shortest paths from some source vertices into a store with narrow cells
+//	Preconditions:	none
+//	Postconditions:	the same as buildPathStore for every vertex, with rows only for
+//					the sources that are vertices in the graph, each kept once. the
+//					rows are computed by the same core as the rows of Table T, on as
+//					many threads as setThreadCount allows, and the previous vertices
+//					are only found for DISTANCES_AND_PATHS
+shared_ptr<PathStore> Graph::buildPathStore(const vector<int>& sources, PathStore::Contents contents,
+	const string& fileName) {
+	freezeAdjacency();
+	prepareSmallAdjacency();
+	vector<int> chosen;
+	vector<bool> listed(size + 1, false);
+	for (int source : sources) {
+		if (isVertex(source) && !listed[source]) {
+			listed[source] = true;
+			chosen.push_back(source);
+		}
+	}
+
+	// no shortest path has more than size - 1 edges, so the heaviest edge bounds
+	// every distance and picks the width of the distance cells
+	uint64_t maxWeight = 0;
+	for (int edge = 0; edge < adjacency.edgeCount(); edge++) {
+		maxWeight = max(maxWeight, static_cast<uint64_t>(adjacency.weightAt(edge)));
+	}
+	uint64_t maxDistance = size > 1 ? maxWeight * static_cast<uint64_t>(size - 1) : 0;
+	maxDistance = min(maxDistance, static_cast<uint64_t>(NO_DISTANCE - 1));
+
+	shared_ptr<PathStore> store = make_shared<PathStore>();
+	if (!store->reset(size + 1, chosen, maxDistance, contents, fileName)) {
+		return nullptr;
+	}
+	// each source only writes its own row, so only one row per worker is held in
+	// full width at a time. the previous vertices are only found when they are kept
+	auto setRow = [&store](int i, const TableRow& row) {
+		store->setRow(i, row.dist, row.path);
+	};
+	if (contents == PathStore::DISTANCES_AND_PATHS) {
+		searchRowsAlong<true>(chosen, false, setRow);
+	}
+	else {
+		searchRowsAlong<false>(chosen, false, setRow);
+	}
+	return store;
+}
+
+
+//-----------------------------------  freeze  -----------------------------------
+//	Brings the compressed adjacency that queries read up to date
+//	Preconditions:	none
+//	Postconditions:	the compressed adjacency holds every edge of the graph, so the
+//					const queries that follow do not have to rebuild it
+void Graph::freeze() const {
+	freezeAdjacency();
+}
+
+
+//--------------------------------  fingerprint  -----------------------------------
+//	Returns a hash of the vertices and edges of the graph
+//	Preconditions:	none
+//	Postconditions:	a 64 bit hash of the number of vertices and of every edge is
+//					returned. graphs with the same edges in the same order have the
+//					same fingerprint, and any edge change almost surely changes it
+uint64_t Graph::fingerprint() const {
+	freezeAdjacency();
+
+	// FNV-1a over the compressed adjacency, one 32 bit word at a time
+	uint64_t hash = 14695981039346656037ULL;
+	auto mix = [&hash](uint32_t word) {
+		hash = (hash ^ word) * 1099511628211ULL;
+	};
+	mix(static_cast<uint32_t>(size));
+	for (int v = 1; v < adjacency.rowCount(); v++) {
+		mix(static_cast<uint32_t>(adjacency.rowEnd(v) - adjacency.rowBegin(v)));
+		for (int edge = adjacency.rowBegin(v); edge < adjacency.rowEnd(v); edge++) {
+			mix(static_cast<uint32_t>(adjacency.adjVertexAt(edge)));
+			mix(static_cast<uint32_t>(adjacency.weightAt(edge)));
+		}
+	}
+	return hash;
+}
+
+
+//-------------------------------  setCoordinates  ---------------------------------
+//	Sets the position of a vertex, for the Euclidean heuristic
+//	Preconditions:	none
+//	Postconditions:	the vertex is at x, y and true is returned, or false is returned
+//					if vertex is not in the graph. copies of the graph that shared the
+//					descriptions keep the old positions
+bool Graph::setCoordinates(int vertex, double x, double y) {
+	if (!isVertex(vertex)) {
+		return false;
+	}
+	// another graph, or a heuristic, still reads the locations, so this graph
+	// takes its own copy before changing them
+	if (locations == nullptr) {
+		locations = make_shared<vector<Location>>(size + 1, Location{ 0.0, 0.0, false });
+	}
+	else if (locations.use_count() > 1) {
+		locations = make_shared<vector<Location>>(*locations);
+	}
+	(*locations)[vertex] = Location{ x, y, true };
+	return true;
+}
+
+
+//---------------------------  bidirectionalSearch  --------------------------------
+//	Finds the shortest path from source to destination by searching forward from
+//	source and backward from destination until the two searches meet
+//	Preconditions:	source and destination are vertices in the graph. adjacency and
+//					reverseAdjacency are up to date. workspace has been prepared for
+//					size vertices
+//	Postconditions:	the distance, the path and the number of vertices settled by
+//					both searches are returned. graph object is not changed
+Graph::PathResult Graph::bidirectionalSearch(int source, int destination,
+	QueryWorkspace& workspace) const {
+	PathResult result;
+	result.distance = NO_DISTANCE;
+	result.settled = 0;
+
+	// forward state walks out-edges from source, backward state walks in-edges
+	// from destination. the backward link of v is the vertex after v on the way
+	// to destination
+	SearchState& forward = workspace.forward;
+	SearchState& backward = workspace.backward;
+	SEARCH_CLOCK(searchStart);
+	forward.reach(source, 0, source);
+	forward.frontier().push(source, 0);
+	backward.reach(destination, 0, destination);
+	backward.frontier().push(destination, 0);
+	SEARCH_COUNT(forward.stats, heapPushes, 1);
+	SEARCH_COUNT(backward.stats, heapPushes, 1);
+
+	// best is the shortest joined path found so far, through vertex meet
+	long long best = LLONG_MAX;
+	int meet = 0;
+	if (source == destination) {
+		best = 0;
+		meet = source;
+	}
+
+	while (!forward.frontier().isEmpty() && !backward.frontier().isEmpty()) {
+		// no path through an unsettled vertex can beat best once the two
+		// frontiers together are at least as far as best
+		if (static_cast<long long>(forward.frontier().minKey()) + backward.frontier().minKey() >= best) {
+			break;
+		}
+		// grow the side whose frontier is closer to its start
+		if (forward.frontier().minKey() <= backward.frontier().minKey()) {
+			settleNext(forward, adjacency, backward, best, meet);
+		}
+		else {
+			settleNext(backward, reverseAdjacency, forward, best, meet);
+		}
+		result.settled++;
+	}
+	SEARCH_PHASE(forward.stats, searchNanoseconds, searchStart);
+
+	SEARCH_CLOCK(traceStart);
+	if (meet > 0) {
+		result.distance = static_cast<Distance>(best);
+		for (int vertex = meet; vertex != source; vertex = forward.link(vertex)) {
+			result.path.push_back(vertex);
+		}
+		result.path.push_back(source);
+		reverse(result.path.begin(), result.path.end());
+		for (int vertex = meet; vertex != destination; ) {
+			vertex = backward.link(vertex);
+			result.path.push_back(vertex);
+		}
+	}
+	SEARCH_PHASE(forward.stats, traceNanoseconds, traceStart);
+	return result;
+}
+
+
+//---------------------------------  settleNext  -----------------------------------
+//	Settles the next vertex of one side of a bidirectional search and relaxes its
+//	edges, recording any path that joins this side to the other side
+//	Preconditions:	the frontier of side is not empty. edges is the adjacency this
+//					side searches. other is the state of the other side
+//	Postconditions:	one vertex is settled. if a joined path shorter than best is
+//					found, best and meet are updated to it
+void Graph::settleNext(SearchState& side, const CSRGraph& edges, const SearchState& other,
+	long long& best, int& meet) {
+	IndexedHeap& frontier = side.frontier();
+	int vertex = frontier.popMin();
+	side.markSettled(vertex);
+	SEARCH_COUNT(side.stats, settled, 1);
+	SEARCH_COUNT(side.stats, edgesScanned, edges.rowEnd(vertex) - edges.rowBegin(vertex));
+
+	for (int edge = edges.rowBegin(vertex); edge < edges.rowEnd(vertex); edge++) {
+		int adjacent = edges.adjVertexAt(edge);
+		Distance newDist = side.dist(vertex) + edges.weightAt(edge);
+		if (!side.isSettled(adjacent) && side.dist(adjacent) > newDist) {
+			side.reach(adjacent, newDist, vertex);
+			SEARCH_COUNT(side.stats, relaxed, 1);
+			if (frontier.contains(adjacent)) {
+				frontier.decreaseKey(adjacent, newDist);
+				SEARCH_COUNT(side.stats, heapDecreases, 1);
+			}
+			else {
+				frontier.push(adjacent, newDist);
+				SEARCH_COUNT(side.stats, heapPushes, 1);
+			}
+		}
+		// the other side has reached adjacent, so the two searches join there
+		if (other.dist(adjacent) < NO_DISTANCE && side.dist(adjacent) < NO_DISTANCE &&
+			static_cast<long long>(side.dist(adjacent)) + other.dist(adjacent) < best) {
+			best = static_cast<long long>(side.dist(adjacent)) + other.dist(adjacent);
+			meet = adjacent;
+		}
+	}
+}
+
+
+//------------------------  printLocationDescriptions  ----------------------------
+//	A helper method that prints the location descriptions along a path
+//	Preconditions:	path holds the vertices of a path in order of travel, or is empty
+//					if there is no path. every vertex has a description
+//	Postconditions:	the vertex data of each vertex of the path is printed. this results
+//					in a detailed path description printed in order of travel. graph
+//					object is not changed
+void Graph::printLocationDescriptions(const vector<int>& path) const {
+	// IF there is no path, the loop prints nothing
+	for (int vertex : path) {
+		cout << descriptions->description(vertex) << endl;
 	}
 }
 
@@ -477,20 +2835,40 @@ void Graph::printLocationDescriptions(const int& source, const int& destination)
 //					to match fromGraph before the copyGraph function was called.
 //	Postconditions:	a deep copy is made of the fromGraph into this Graph object.
 //					this should now be identical to fromGraph. the table is updated
-//					to match the table in fromGraph
+//					to match the table in fromGraph. if sharedTopology is true and
+//					the compressed adjacency of fromGraph is up to date, it is shared
+//					instead and the lists and the table are not copied
 void Graph::copyGraph(const Graph& fromGraph) {
-	
-	for (int i = 1; i <= size; i++) {
-		vertices[i].data = new Vertex;
-		*vertices[i].data = *fromGraph.vertices[i].data;
-		vertices[i].edgeHead = nullptr;
+	vertices.assign(size + 1, VertexNode{ nullptr });
+
+	// the descriptions are never changed once read, so they are shared, and so are
+	// the locations until one of the graphs sets a position
+	descriptions = fromGraph.descriptions;
+	locations = fromGraph.locations;
+
+	// the compressed adjacency is never changed once built, so copying it only
+	// shares its arrays
+	adjacency = fromGraph.adjacency;
+	reverseAdjacency = fromGraph.reverseAdjacency;
+	adjacencyStale = fromGraph.adjacencyStale.load();
+
+	if (sharedTopology && !fromGraph.adjacencyStale) {
+		// adjacency holds every edge, so the lists are built from it the first
+		// time an edge of this graph is changed
+		adjacencyListsMissing = true;
+		T.clear();
+		tableStale = false;
+		return;
+	}
 
+	edgePool.reserve(edgeCount);
+	for (int i = 1; i <= size; i++) {
 		// EdgeNode pointer to head of graph.vertices list
 		EdgeNode* fromGraphEdgeNode = fromGraph.vertices[i].edgeHead;
 
 		// copy the edgeHead 
 		if (fromGraphEdgeNode != nullptr) {
-			vertices[i].edgeHead = new EdgeNode;
+			vertices[i].edgeHead = edgePool.create();
 			vertices[i].edgeHead->adjVertex = fromGraphEdgeNode->adjVertex;
 			vertices[i].edgeHead->weight = fromGraphEdgeNode->weight;
 			vertices[i].edgeHead->nextEdge = nullptr;
@@ -503,7 +2881,7 @@ void Graph::copyGraph(const Graph& fromGraph) {
 
 		// move fromGraphEdgeNode to the next edge
 		while (fromGraphEdgeNode != nullptr) {
-			temp = new EdgeNode;
+			temp = edgePool.create();
 			temp->adjVertex = fromGraphEdgeNode->adjVertex;
 			temp->weight = fromGraphEdgeNode->weight;
 			temp->nextEdge = nullptr;
@@ -513,11 +2891,38 @@ void Graph::copyGraph(const Graph& fromGraph) {
 		}
 	}
 	// copy the table T
-	for (int row = 0; row < MAX_VERTICES; row++) {
-		for (int column = 0; column < MAX_VERTICES; column++) {
-			T[row][column].dist = fromGraph.T[row][column].dist;
-			T[row][column].path = fromGraph.T[row][column].path;
-			T[row][column].visited = fromGraph.T[row][column].visited;
-		}
-	}	
+	adjacencyListsMissing = fromGraph.adjacencyListsMissing;
+	T = fromGraph.T;
+	tableStale = fromGraph.tableStale;
+}
+
+
+//--------------------------------  moveGraph  -----------------------------------
+//	Helper method that move constructor and move assignment operator use to take
+//	the contents of a graph
+//	Preconditions:	this Graph object is empty. fromGraph is not this object
+//	Postconditions:	this Graph object holds what fromGraph held and fromGraph is
+//					empty. no EdgeNode, description or table row is copied
+void Graph::moveGraph(Graph& fromGraph) {
+	// the EdgeNodes stay where they are, only the pool that owns them changes
+	vertices = move(fromGraph.vertices);
+	edgePool = move(fromGraph.edgePool);
+	descriptions = move(fromGraph.descriptions);
+	locations = move(fromGraph.locations);
+	adjacency = fromGraph.adjacency;
+	reverseAdjacency = fromGraph.reverseAdjacency;
+	T = move(fromGraph.T);
+
+	size = fromGraph.size;
+	edgeCount = fromGraph.edgeCount;
+	queueStrategy = fromGraph.queueStrategy;
+	threadCount = fromGraph.threadCount;
+	incrementalRepair = fromGraph.incrementalRepair;
+	sharedTopology = fromGraph.sharedTopology;
+	traceCallback = fromGraph.traceCallback;
+	adjacencyStale = fromGraph.adjacencyStale.load();
+	adjacencyListsMissing = fromGraph.adjacencyListsMissing;
+	tableStale = fromGraph.tableStale;
+
+	fromGraph.clearGraph();
 }
@@ -4,48 +4,217 @@
 // Class Declarations
 //--------------------------------------------------------------------------------------
 // Graph Class:	A graph class that reads data from a text file and stores it in 
-//				a Vertex object, an EdgeNode, or a VertexNode. It uses this data to 
+//				a DescriptionArena, an EdgeNode, or a VertexNode. It uses this data to 
 //				create a directed, weighted graph using an adjacency list implementation. 
 //				The class is primarily used to run Dijkstra's Algorithm but also 
 //				allows for other methods:
-//   --	allows reading data in from a file and putting into a graph
+//   --	allows reading data in from a file and putting into a graph, scanning the
+//		edges straight from the stream buffer and linking them in one pass
 //   --	computes the shortest path between every pair of vertices
 //   --	outputs a shortest path table that includes all possible paths and their 
 //		details from a source node to a destination node
+//   --	allows for writing that table through a large buffer to any stream or file
+//		descriptor, as text, comma or tab separated values, or binary records
 //   --	outputs individual paths from a source node to a destination node
+//   --	returns the path from a source node to a destination node as data, in a
+//		vector or a buffer the caller owns, without printing it
+//   --	keeps the vertex descriptions end to end in one shared block, read
+//		straight from the file with no allocation per vertex, and allows finding
+//		a vertex by its description through a hash index
+//   --	allows for saving a graph to a binary snapshot file and loading it back by
+//		memory mapping the file, with no parsing and no allocation per edge
 //   --	allows for inserting a directed edge when given a source vertex, destination
 //		vertex, and a weight
 //   --	allows for removing an edge when given the source and destination vertices
+//   --	allocates its edge nodes from a block pool it owns, so clearing the graph
+//		releases every node in one go
 //   --	allows for constructing a new graph with a parameter of an already existing
 //		graph
 //   --	allows for assigning an existing graph another existing graph
+//   --	allows for moving a graph into another graph in constant time
+//   --	allows for copies that share the compressed adjacency of the graph they
+//		were copied from, building their own adjacency lists only when an edge
+//		is inserted or removed
+//   --	allows for choosing how the next vertex is picked in Dijkstra's Algorithm,
+//		either a linear scan of the table, a scan using SIMD instructions, an
+//		indexed binary heap, or a radix heap of integer distances, or for
+//		running it as delta stepping with the edges of each bucket relaxed on
+//		several threads
+//   --	keeps a compressed sparse row copy of the adjacency lists that the 
+//		shortest path searches read from
+//   --	runs the heap and radix heap searches through one Dijkstra core that is
+//		compiled for each edge storage and frontier, with 16 bit subscripts and
+//		weights for graphs small enough and the full width ones otherwise
+//   --	caches the shortest paths from each source vertex until an edge changes,
+//		computing them only for the source vertices that are asked about
+//   --	allows for repairing the cached paths when an edge changes instead of
+//		dropping them, touching only the sources the change affects
+//   --	keeps the table of each source as separate arrays of distances, previous
+//		vertices and visited bits, with 32 bit distances or, when built with
+//		DIJKSTRA_WIDE_DISTANCE, 64 bit distances
+//   --	allows for computing the rows of all sources on several threads at once
+//   --	answers a single source to destination query with a search that stops
+//		once the destination is reached, returning the path instead of printing
+//   --	allows for answering that query with a bidirectional search, which meets
+//		a search from the source and one from the destination in the middle
+//   --	answers a batch of source to destination queries with one run per
+//		distinct source, optionally spread over several threads
+//   --	allows for starting one search from several sources at once, each at its
+//		own starting distance, to find the nearest source of a set of targets
+//		or every vertex within a distance of the sources, and for stopping a
+//		one to many search once every target it lists is settled
+//   --	allows for answering a single query with an A* search guided by a
+//		heuristic: none, the straight line distance between vertex coordinates,
+//		or lower bounds from the distances to and from a few landmarks
+//   --	allows for choosing landmarks and computing their distances once, and
+//		saving them to a file that is only loaded back for a graph with the same
+//		edges
+//   --	allows for computing the shortest paths from every vertex, or from some,
+//		into a store whose cells are only as wide as the graph needs, kept in
+//		memory or in a file mapped into memory, with or without the paths
+//   --	runs single queries in a workspace that is kept from one query to the
+//		next, or one the caller keeps, so a query only resets what it touched
+//   --	allows for const queries, displays and reports that leave Table T alone
+//		and keep their state in a workspace the caller owns, so many threads can
+//		query one graph at once without locks
+//   --	when built with DIJKSTRA_STATS, counts what each search does and how long
+//		each phase takes, keeps the totals, and hands each table row and query
+//		to a trace callback. otherwise the counting is compiled out
 //
 // Assumptions:
 //   -- all pointers are initialized to nullptr unless instructed otherwise
 //   -- the file that buildGraph uses is in the same directory as the source file
 //   -- the default constructor creates a graph object and sets the VertexNode 
 //		variables to nullptr
-//   -- the VertexNodes being stored in the graph have a pointer to a Vertex object
-//		with a private variable holding a string
-//   -- there are not more than 100 vertices
+//   -- the description of vertex v is entry v of the description arena, entry 0
+//		is empty
+//   -- vertex storage is sized from the number of vertices read by buildGraph,
+//		so there is no fixed limit on the number of vertices
 //   -- the destructor will release all dynamic memory
+//   -- EdgeNodes are only created and destroyed through the graph's pool, never
+//		with new and delete
+//   -- vertex descriptions are not changed once they are read, so copies of the
+//		graph share them instead of copying them. coordinates are kept apart
+//		from them, and setCoordinates copies the coordinates first if they are
+//		shared
+//   -- when two vertices have the same description, findVertex returns the
+//		lower subscript
+//   -- coordinates are not written to snapshots
+//   -- the graph is not changed while const queries run on other threads. the
+//		first of them to find the compressed adjacency stale rebuilds it
 //   -- the file will have the correct vertices number in it to set size to the 
 //		correct integer value
 //--------------------------------------------------------------------------------------
 
 
-#include "Vertex.h"
+#pragma once
+#include "CSRGraph.h"
+#include "DescriptionArena.h"
+#include "Distance.h"
+#include "IndexedHeap.h"
+#include "LandmarkTable.h"
+#include "PathStore.h"
+#include "QueryWorkspace.h"
+#include "ReportWriter.h"
+#include "SearchPolicies.h"
+#include "NodePool.h"
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 class Graph {
+	// the contraction hierarchy reads the compressed adjacency and shares the
+	// descriptions of the graph it is built from
+	friend class ContractionHierarchy;
 public:
+	// strategies for picking the next vertex to visit in Dijkstra's Algorithm
+	enum QueueStrategy {
+		AUTO_QUEUE,				// pick per graph from the number of vertices and edges
+		LINEAR_SCAN,			// scan the whole table row, O(V^2) per source
+		VECTOR_SCAN,			// scan the row with SIMD instructions, O(V^2) per source
+		BINARY_HEAP,			// indexed binary heap, O((V + E) log V) per source
+		RADIX_HEAP,				// monotone radix heap of integer distances
+		DELTA_STEPPING			// buckets of width delta, relaxed on several threads
+	};
+
+	// ways of searching for a single source to destination path
+	enum SearchDirection {
+		UNIDIRECTIONAL,			// one search forward from the source
+		BIDIRECTIONAL			// forward from the source and backward from the destination
+	};
+
+	// answer to a single source to destination query
+	struct PathResult {
+		Distance distance;		// length of the shortest path, NO_DISTANCE if there is none
+		vector<int> path;		// vertices from source to destination, empty if no path
+		int settled;			// number of vertices the search settled
+	};
+
+	// one source to destination query of a batch
+	struct PathQuery {
+		int source;				// subscript of the source vertex
+		int destination;		// subscript of the destination vertex
+	};
+
+	// one start of a search from several sources
+	struct SearchSource {
+		int vertex;				// subscript of the source vertex
+		Distance offset;		// distance the search starts vertex at, 0 or more
+	};
+
+	// a vertex reached by a search and its distance
+	struct VertexDistance {
+		int vertex;				// subscript of the vertex
+		Distance distance;		// distance from the nearest source, offset included
+	};
+
+	// estimate of the distance left from a vertex to the destination of an A*
+	// search. it must never be more than the shortest path from vertex to the
+	// destination, and NO_DISTANCE means the destination cannot be reached
+	typedef function<Distance(int vertex)> Heuristic;
+
+	// called with what each table row and single query did, when the counters are
+	// compiled in with DIJKSTRA_STATS. it may be called on several threads at once
+	typedef function<void(const QueryTrace& trace)> TraceCallback;
+
+
 	//----------------------------------- buildGraph ---------------------------------------
 	// Builds a graph by reading data from an ifstream
 	// Preconditions:  infile has been successfully opened and the file contains
 	//                 properly formated data (according to the program specs)
-	// Postconditions: One graph is read from infile and stored in the object			
+	// Postconditions: One graph is read from infile and stored in the object, 
+	//				   replacing anything the object held before. when an edge is
+	//				   listed more than once, the last weight listed is kept
 	void buildGraph(ifstream& infile);
 
 	
+	//-------------------------------  saveSnapshot  ---------------------------------------
+	//	Writes the graph to a binary snapshot file that loadSnapshot can map
+	//	Preconditions:	none
+	//	Postconditions:	the vertex descriptions and the compressed adjacency, forward
+	//					and reverse, are written to fileName. true is returned if the
+	//					file was written, otherwise false. the graph is not changed
+	bool saveSnapshot(const string& fileName);
+
+
+	//-------------------------------  loadSnapshot  ---------------------------------------
+	//	Replaces the graph with one read from a binary snapshot file
+	//	Preconditions:	fileName was written by saveSnapshot on a machine with the same
+	//					byte order, and is not changed while the graph uses it
+	//	Postconditions:	if the file is a snapshot of this version whose offsets and
+	//					adjacent vertices are all in range, the graph holds the
+	//					snapshot and true is returned. the edges are used in place from
+	//					the mapped file, and the adjacency lists are only built if an 
+	//					edge is inserted or removed. otherwise false is returned and the
+	//					graph is not changed
+	bool loadSnapshot(const string& fileName);
+
+
 	//----------------------------------  constructor  -------------------------------------
 	//	Default constructor the Graph class
 	//	Preconditions:	there is enough space in memory for Graph object to be instantiated
@@ -82,6 +251,66 @@ public:
 	//					the same as fromGraph. a deep copy was made
 	Graph& operator=(const Graph& fromGraph);
 
+
+	//-------------------------------  move constructor  -----------------------------------
+	//	Move constructor for the Graph class that takes the contents of another Graph
+	//	Preconditions:	graph is a Graph object that has previously been instantiated
+	//	Postconditions:	a new Graph object is created that holds what graph held, in
+	//					constant time. graph is left empty
+	Graph(Graph&& graph);
+
+
+	//---------------------------  move assignment operator  -------------------------------
+	//	Overloaded assignment operator that moves a Graph object into a pre-existing
+	//	Graph object
+	//	Preconditions:	none
+	//	Postconditions:	the data of this Graph object is released and this object holds
+	//					what fromGraph held, in constant time. fromGraph is left empty
+	Graph& operator=(Graph&& fromGraph);
+
+
+	//----------------------------  setSharedTopology  -------------------------------------
+	//	Sets whether copies of the graph share its edges instead of copying them
+	//	Preconditions:	none
+	//	Postconditions:	while shared is true, the copy constructor and assignment
+	//					operator share the compressed adjacency of this graph with the
+	//					copy, and the copy builds its own adjacency lists the first time
+	//					an edge of it is inserted or removed. the copy starts with no
+	//					cached rows of Table T. copies keep the setting. the default is
+	//					false, which makes a deep copy
+	void setSharedTopology(bool shared);
+
+
+	//----------------------------  getSharedTopology  -------------------------------------
+	//	Returns the setting that was set with setSharedTopology
+	//	Preconditions:	none
+	//	Postconditions:	the setting is returned. graph object is not changed
+	bool getSharedTopology() const;
+
+
+	//------------------------------  getVertexCount  --------------------------------------
+	//	Returns the number of vertices in the graph
+	//	Preconditions:	none
+	//	Postconditions:	the number of vertices is returned, they are numbered 1 to it.
+	//					graph object is not changed
+	int getVertexCount() const;
+
+
+	//-------------------------------  getEdgeCount  ---------------------------------------
+	//	Returns the number of edges in the graph
+	//	Preconditions:	none
+	//	Postconditions:	the number of edges is returned. graph object is not changed
+	int getEdgeCount() const;
+
+
+	//--------------------------------  findVertex  ----------------------------------------
+	//	Finds a vertex by its description
+	//	Preconditions:	none
+	//	Postconditions:	the subscript of the vertex whose description is the same as
+	//					description is returned, or 0 if there is none. graph object is
+	//					not changed
+	int findVertex(const string& description) const;
+
 	
 	//----------------------------------  insertEdge  --------------------------------------
 	//	Inserts an edge into the Graph object. The edge is weighted and directed
@@ -114,12 +343,11 @@ public:
 	//	A method that finds the shortest path from all source vertices to all destination
 	//	vertices
 	//	Preconditions:	Table T exists in the Graph object. all vertices that the algorithm
-	//					is asked to run for have been added to the graph. MAX_VERTICES is
-	//					an accurate value of the maximum amount of vertices allowed in
-	//					the graph
+	//					is asked to run for have been added to the graph
 	//	Postconditions:	the algorithm for finding the shortest path is ran with every
 	//					requested vertex as the source vertex. the private member Table T is 
-	//					updated with results from the algorithm. 
+	//					updated with results from the algorithm. rows of Table T that are
+	//					already up to date are not computed again
 	void findShortestPath();
 
 	
@@ -127,7 +355,7 @@ public:
 	//	Displays the shortest path from all vertices in the graph to all vertices in
 	//	the graph
 	//	Preconditions:	the private data member of Graph, Table T, is accurate and up to
-	//					data. all vertex pointers in VertexNode point to a vertex object
+	//					data. every vertex has a description
 	//	Postconditions:	the findShortestPath function is called to update the 
 	//					private data member Table T. for each vertex, all data from the 
 	//					vertex to a destination vertex is printed in a table format. the 
@@ -135,22 +363,418 @@ public:
 	//					travelled are printed in a table format.
 	void displayAll();
 
+
+	//----------------------------------  displayAll  --------------------------------------
+	//	Displays the shortest path from every vertex to every other vertex, searching in
+	//	a workspace the caller keeps
+	//	Preconditions:	the graph is not changed while the call runs. workspace is not
+	//					used by another call at the same time
+	//	Postconditions:	the same table as displayAll without a workspace is printed.
+	//					Table T is not used or changed
+	void displayAll(QueryWorkspace& workspace) const;
+
+
+	//---------------------------------  writeReport  --------------------------------------
+	//	Writes the shortest path from every vertex to every other vertex to a report
+	//	Preconditions:	none
+	//	Postconditions:	the findShortestPath function is called to update Table T. for
+	//					each source vertex a row is written for every other vertex, with
+	//					the path rebuilt from the previous vertices in Table T. the
+	//					writer is flushed. true is returned if everything was written
+	bool writeReport(ReportWriter& writer);
+
+
+	//---------------------------------  writeReport  --------------------------------------
+	//	Writes the shortest path from every vertex to every other vertex to a report,
+	//	searching in a workspace the caller keeps
+	//	Preconditions:	the graph is not changed while the call runs. workspace is not
+	//					used by another call at the same time
+	//	Postconditions:	the same rows as writeReport without a workspace are written, from
+	//					one search per source run in workspace. Table T is not used or
+	//					changed. the writer is flushed. true is returned if everything
+	//					was written
+	bool writeReport(ReportWriter& writer, QueryWorkspace& workspace) const;
+
+
+	//---------------------------------  writeReport  --------------------------------------
+	//	Writes the shortest path report to a stream in the given format
+	//	Preconditions:	out is open for writing
+	//	Postconditions:	the report is written through a buffered ReportWriter. true is
+	//					returned if everything was written
+	bool writeReport(ostream& out, ReportWriter::Format format = ReportWriter::TEXT);
+
+
+	//---------------------------------  writeReport  --------------------------------------
+	//	Writes the shortest path report to a file descriptor in the given format
+	//	Preconditions:	fileDescriptor is open for writing
+	//	Postconditions:	the report is written through a buffered ReportWriter. true is
+	//					returned if everything was written. fileDescriptor is not closed
+	bool writeReport(int fileDescriptor, ReportWriter::Format format = ReportWriter::TEXT);
+
 	
 	//------------------------------------  display  ---------------------------------------
 	//	Displays a single, detailed path from a source vertex to a destination vertex
-	//	Preconditions:	the parameters passed in are integer values. all vertex pointers 
-	//					in VertexNode point to a vertex object		
-	//	Postconditions:	the findShortestPath function is called to update the 
-	//					private data member Table T. The specific data from the requested
+	//	Preconditions:	the parameters passed in are integer values. every vertex has a 
+	//					description
+	//	Postconditions:	the row of Table T for source is computed if it is not cached
+	//					already. The specific data from the requested
 	//					source vertex to destination vertex is printed including the 
 	//					source vertex, destination vertex, distance travelled, exact path,
-	//					and the name of the vertex. 
+	//					and the name of the vertex. if either vertex is not in the graph,
+	//					only the line with -- for the distance is printed, as for a
+	//					destination that cannot be reached
 	void display(int source, int destination);
 
 
-private:
-	static const int MAX_VERTICES = 101;
+	//------------------------------------  display  ---------------------------------------
+	//	Displays a single, detailed path from a source vertex to a destination vertex,
+	//	searching in a workspace the caller keeps
+	//	Preconditions:	the graph is not changed while the call runs. workspace is not
+	//					used by another call at the same time
+	//	Postconditions:	the same lines as display without a workspace are printed. Table
+	//					T is not used, so many threads can display paths of one graph at
+	//					once, each with its own workspace
+	void display(int source, int destination, QueryWorkspace& workspace) const;
+
+
+	//--------------------------------  shortestPath  --------------------------------------
+	//	Finds the shortest path from a source vertex to a destination vertex
+	//	Preconditions:	none
+	//	Postconditions:	a single search is ran from source and stopped as soon as 
+	//					destination is settled. the distance, the path from source to 
+	//					destination and the number of vertices settled are returned. if
+	//					there is no path, or either vertex is not in the graph, the
+	//					distance is NO_DISTANCE and the path is empty. Table T is not changed.
+	//					with BIDIRECTIONAL a backward search from destination runs too, and
+	//					settled counts the vertices settled by both searches. the search
+	//					works in a workspace the graph keeps from one query to the next
+	PathResult shortestPath(int source, int destination, SearchDirection direction = UNIDIRECTIONAL);
+
+
+	//--------------------------------  shortestPath  --------------------------------------
+	//	Finds the shortest path from a source vertex to a destination vertex in a
+	//	workspace the caller keeps
+	//	Preconditions:	the graph is not changed while the call runs. workspace is not
+	//					used by another call at the same time
+	//	Postconditions:	the same result as shortestPath without a workspace is returned.
+	//					the search only writes the vertices it reaches in workspace, so
+	//					the cost of the query does not grow with the size of the graph.
+	//					Table T is not used, so many threads can query one graph at once,
+	//					each with its own workspace
+	PathResult shortestPath(int source, int destination, QueryWorkspace& workspace,
+		SearchDirection direction = UNIDIRECTIONAL) const;
+
+
+	//----------------------------------  getPath  -----------------------------------------
+	//	Returns the shortest path from a source vertex to a destination vertex
+	//	Preconditions:	none
+	//	Postconditions:	the row of Table T for source is computed if it is not cached
+	//					already. the vertices from source to destination are returned in
+	//					order of travel, or an empty vector if there is no path or either
+	//					vertex is not in the graph. nothing is printed
+	vector<int> getPath(int source, int destination);
+
+
+	//----------------------------------  getPath  -----------------------------------------
+	//	Fills a buffer the caller owns with the shortest path from a source vertex to a
+	//	destination vertex
+	//	Preconditions:	buffer holds capacity ints, or is nullptr if capacity is 0
+	//	Postconditions:	the row of Table T for source is computed if it is not cached
+	//					already. the number of vertices in the path is returned, 0 if
+	//					there is no path or either vertex is not in the graph. if it is
+	//					no more than capacity, buffer holds the path in order of travel,
+	//					otherwise buffer is not changed
+	int getPath(int source, int destination, int* buffer, int capacity);
+
+
+	//--------------------------------  shortestPaths  -------------------------------------
+	//	Answers many source to destination queries at once
+	//	Preconditions:	none
+	//	Postconditions:	the queries are grouped by source, and the row of Table T for each
+	//					distinct source is computed once if it is not cached already, on
+	//					as many threads as setThreadCount allows. one result is returned
+	//					per query, in the order of queries. settled is the number of
+	//					vertices the run from that source settled. a query with a vertex
+	//					that is not in the graph gets NO_DISTANCE and an empty path
+	vector<PathResult> shortestPaths(const vector<PathQuery>& queries);
+
+
+	//------------------------------  shortestPathAStar  -----------------------------------
+	//	Finds the shortest path from a source vertex to a destination vertex with an A*
+	//	search guided by a heuristic
+	//	Preconditions:	heuristic never estimates more than the distance left to
+	//					destination
+	//	Postconditions:	vertices are settled in order of their distance from source plus
+	//					their estimate, and the search stops as soon as destination is
+	//					settled. the result is the same as shortestPath gives, with
+	//					settled counting every vertex taken off the frontier. a vertex
+	//					whose estimate is NO_DISTANCE is never entered. Table T is not changed
+	PathResult shortestPathAStar(int source, int destination, const Heuristic& heuristic);
+
+
+	//------------------------------  shortestPathAStar  -----------------------------------
+	//	Finds the shortest path from a source vertex to a destination vertex with an A*
+	//	search guided by a heuristic, in a workspace the caller keeps
+	//	Preconditions:	heuristic never estimates more than the distance left to
+	//					destination, and is safe to call from several threads if
+	//					several threads query at once. the graph is not changed while the
+	//					call runs. workspace is not used by another call at the same time
+	//	Postconditions:	the same result as shortestPathAStar without a workspace is
+	//					returned. the search only writes the vertices it reaches in
+	//					workspace
+	PathResult shortestPathAStar(int source, int destination, const Heuristic& heuristic,
+		QueryWorkspace& workspace) const;
+
+
+	//---------------------------  shortestPathsFromSources  -------------------------------
+	//	Finds the shortest path to each of a set of targets from the nearest of a set of
+	//	sources, with one search
+	//	Preconditions:	none
+	//	Postconditions:	every source starts on the frontier at its offset, and the search
+	//					stops as soon as every target is settled. one result is returned
+	//					per target, in the order of targets, holding the distance from
+	//					the nearest source with its offset and the path from that source.
+	//					settled is the number of vertices the one search settled. a
+	//					source that is not in the graph or has a negative offset is left
+	//					out, and a target that is not in the graph or is not reached gets
+	//					NO_DISTANCE and an empty path. with one source at offset 0 this
+	//					is a one to many search. Table T is not changed
+	vector<PathResult> shortestPathsFromSources(const vector<SearchSource>& sources,
+		const vector<int>& targets);
+
+
+	//---------------------------  shortestPathsFromSources  -------------------------------
+	//	Finds the shortest path to each of a set of targets from the nearest of a set of
+	//	sources, with one search in a workspace the caller keeps
+	//	Preconditions:	the graph is not changed while the call runs. workspace is not
+	//					used by another call at the same time
+	//	Postconditions:	the same results as shortestPathsFromSources without a workspace
+	//					are returned. workspace.forward holds the distances and previous
+	//					vertices of the search
+	vector<PathResult> shortestPathsFromSources(const vector<SearchSource>& sources,
+		const vector<int>& targets, QueryWorkspace& workspace) const;
+
+
+	//--------------------------------  verticesWithin  ------------------------------------
+	//	Finds every vertex within a distance of the nearest of a set of sources, with one
+	//	search
+	//	Preconditions:	none
+	//	Postconditions:	every source starts on the frontier at its offset, and the search
+	//					settles every vertex whose distance from the nearest source, with
+	//					its offset, is no more than limit. those vertices are returned
+	//					with their distances, in order of distance. a source that is not
+	//					in the graph or has a negative offset is left out. Table T is not
+	//					changed
+	vector<VertexDistance> verticesWithin(const vector<SearchSource>& sources, Distance limit);
+
+
+	//--------------------------------  verticesWithin  ------------------------------------
+	//	Finds every vertex within a distance of the nearest of a set of sources, with one
+	//	search in a workspace the caller keeps
+	//	Preconditions:	the graph is not changed while the call runs. workspace is not
+	//					used by another call at the same time
+	//	Postconditions:	the same vertices as verticesWithin without a workspace are
+	//					returned. workspace.forward holds the distances and previous
+	//					vertices of the search
+	vector<VertexDistance> verticesWithin(const vector<SearchSource>& sources, Distance limit,
+		QueryWorkspace& workspace) const;
+
+
+	//-------------------------------  zeroHeuristic  --------------------------------------
+	//	Returns a heuristic that estimates 0 for every vertex
+	//	Preconditions:	none
+	//	Postconditions:	the heuristic is returned. with it shortestPathAStar settles the
+	//					same vertices as a plain Dijkstra search
+	static Heuristic zeroHeuristic();
+
+
+	//----------------------------  euclideanHeuristic  ------------------------------------
+	//	Returns a heuristic that estimates the straight line distance to a destination
+	//	Preconditions:	every edge is at least scale times as heavy as the straight line
+	//					distance between the coordinates of its two vertices
+	//	Postconditions:	the heuristic is returned. it estimates scale times the straight
+	//					line distance from a vertex to destination, rounded down, and 0
+	//					when either vertex has no coordinates. it keeps the coordinates
+	//					the vertices have now
+	Heuristic euclideanHeuristic(int destination, double scale = 1.0) const;
+
+
+	//-----------------------------  landmarkHeuristic  ------------------------------------
+	//	Returns a heuristic that estimates the distance to a destination from the
+	//	distances to and from a set of landmarks
+	//	Preconditions:	table was built by buildLandmarks and no edge has changed since
+	//	Postconditions:	the heuristic is returned. it estimates the lower bound of the
+	//					table from a vertex to destination, and holds on to the table
+	static Heuristic landmarkHeuristic(shared_ptr<const LandmarkTable> table, int destination);
+
+
+	//-------------------------------  buildLandmarks  -------------------------------------
+	//	Computes the distances from and to a set of landmark vertices
+	//	Preconditions:	every landmark is a vertex in the graph
+	//	Postconditions:	a table is returned holding a search from each landmark along the
+	//					edges and one along the reversed edges. a landmark that is not a
+	//					vertex in the graph is skipped. Table T is not changed
+	shared_ptr<LandmarkTable> buildLandmarks(const vector<int>& landmarks);
+
+
+	//-------------------------------  buildLandmarks  -------------------------------------
+	//	Chooses a number of landmark vertices and computes the distances from and to them
+	//	Preconditions:	count is greater than or equal to 0
+	//	Postconditions:	landmarks are chosen one at a time, each the vertex farthest by
+	//					round trip from the landmarks chosen before it, starting with the
+	//					vertex farthest from vertex 1. a vertex no landmark reaches or is
+	//					reached from counts as farthest. a table holding up to count
+	//					landmarks is returned. Table T is not changed
+	shared_ptr<LandmarkTable> buildLandmarks(int count);
+
+
+	//-------------------------------  saveLandmarks  --------------------------------------
+	//	Writes a landmark table to a file, tagged with this graph's fingerprint
+	//	Preconditions:	table was built from this graph and no edge has changed since
+	//	Postconditions:	true is returned if the file was written, otherwise false
+	bool saveLandmarks(const string& fileName, const LandmarkTable& table) const;
+
+
+	//-------------------------------  loadLandmarks  --------------------------------------
+	//	Reads a landmark table that saveLandmarks wrote for this graph
+	//	Preconditions:	none
+	//	Postconditions:	the table is returned if the file holds one saved for a graph
+	//					with the same fingerprint, so the preprocessing can be skipped.
+	//					otherwise nullptr is returned
+	shared_ptr<LandmarkTable> loadLandmarks(const string& fileName) const;
+
+
+	//-------------------------------  buildPathStore  -------------------------------------
+	//	Computes the shortest paths from every vertex into a store with narrow cells
+	//	Preconditions:	none
+	//	Postconditions:	a store holding one row per vertex, with the distances and, for
+	//					DISTANCES_AND_PATHS, the previous vertices, is returned. it is kept
+	//					in memory if fileName is empty, otherwise in fileName mapped into
+	//					memory. nullptr is returned if the file could not be made. Table T
+	//					is not changed
+	shared_ptr<PathStore> buildPathStore(PathStore::Contents contents, const string& fileName = "");
+
+
+	//-------------------------------  buildPathStore  -------------------------------------
+	//	Computes the shortest paths from some source vertices into a store with narrow cells
+	//	Preconditions:	none
+	//	Postconditions:	the same as buildPathStore for every vertex, with rows only for
+	//					the sources that are vertices in the graph, each kept once. the
+	//					rows are computed by the same core as the rows of Table T, on as
+	//					many threads as setThreadCount allows, and the previous vertices
+	//					are only found for DISTANCES_AND_PATHS
+	shared_ptr<PathStore> buildPathStore(const vector<int>& sources, PathStore::Contents contents,
+		const string& fileName = "");
+
+
+	//-----------------------------------  freeze  -----------------------------------------
+	//	Brings the compressed adjacency that queries read up to date
+	//	Preconditions:	none
+	//	Postconditions:	the compressed adjacency holds every edge of the graph, so the
+	//					const queries that follow do not have to rebuild it
+	void freeze() const;
+
+
+	//--------------------------------  fingerprint  ---------------------------------------
+	//	Returns a hash of the vertices and edges of the graph
+	//	Preconditions:	none
+	//	Postconditions:	a 64 bit hash of the number of vertices and of every edge is
+	//					returned. graphs with the same edges in the same order have the
+	//					same fingerprint, and any edge change almost surely changes it
+	uint64_t fingerprint() const;
+
+
+	//-------------------------------  setCoordinates  -------------------------------------
+	//	Sets the position of a vertex, for the Euclidean heuristic
+	//	Preconditions:	none
+	//	Postconditions:	the vertex is at x, y and true is returned, or false is returned
+	//					if vertex is not in the graph. copies of the graph that shared the
+	//					descriptions keep the old positions
+	bool setCoordinates(int vertex, double x, double y);
+
+
+	//-----------------------------  setQueueStrategy  -------------------------------------
+	//	Sets how findShortestPath picks the next vertex to visit
+	//	Preconditions:	strategy is one of the QueueStrategy values
+	//	Postconditions:	later calls to findShortestPath use strategy. AUTO_QUEUE picks
+	//					the binary heap unless the graph is dense enough that a scan
+	//					of the row is cheaper, and then picks the vectorized scan.
+	//					RADIX_HEAP and DELTA_STEPPING give the same distances as the
+	//					others, but a path may be another path of the same length
+	void setQueueStrategy(QueueStrategy strategy);
+
+
+	//-----------------------------  getQueueStrategy  -------------------------------------
+	//	Returns the strategy that was set with setQueueStrategy
+	//	Preconditions:	none
+	//	Postconditions:	the current strategy is returned. graph object is not changed
+	QueueStrategy getQueueStrategy() const;
+
+
+	//------------------------------  setThreadCount  --------------------------------------
+	//	Sets how many worker threads findShortestPath spreads the source vertices over
+	//	Preconditions:	threadCount is greater than or equal to 0
+	//	Postconditions:	later calls to findShortestPath use threadCount workers, or one
+	//					per hardware thread if threadCount is 0. the default is 1, which
+	//					computes every source on the calling thread. with DELTA_STEPPING
+	//					the sources are computed one at a time and the workers share
+	//					the relaxations of each source instead
+	void setThreadCount(int threadCount);
+
+
+	//------------------------------  getThreadCount  --------------------------------------
+	//	Returns the thread count that was set with setThreadCount
+	//	Preconditions:	none
+	//	Postconditions:	the thread count is returned. graph object is not changed
+	int getThreadCount() const;
+
+
+	//---------------------------  setIncrementalRepair  ------------------------------------
+	//	Sets whether inserting or removing an edge repairs the cached rows of Table T
+	//	Preconditions:	none
+	//	Postconditions:	while repair is true, a change to an edge keeps the cached rows.
+	//					a shorter edge is propagated from its destination through the rows
+	//					it improves, and a longer or removed edge empties only the rows
+	//					whose shortest path tree uses it. the distances match a full
+	//					recompute, but a path may be another path of the same length.
+	//					the default is false, which empties every row on any change
+	void setIncrementalRepair(bool repair);
+
+
+	//---------------------------  getIncrementalRepair  ------------------------------------
+	//	Returns the setting that was set with setIncrementalRepair
+	//	Preconditions:	none
+	//	Postconditions:	the setting is returned. graph object is not changed
+	bool getIncrementalRepair() const;
+
+
+	//-----------------------------  setTraceCallback  -------------------------------------
+	//	Sets the function that is called after each table row and single query
+	//	Preconditions:	the callback is not changed while queries run on other threads
+	//	Postconditions:	when built with DIJKSTRA_STATS, callback is called with the kind,
+	//					the ends and the counters of every row of Table T computed and
+	//					every single query answered from then on. an empty callback
+	//					turns the tracing off. without DIJKSTRA_STATS it is never called
+	void setTraceCallback(TraceCallback callback);
+
 
+	//------------------------------  getSearchStats  --------------------------------------
+	//	Returns the counters of every search since the graph was made or they were reset
+	//	Preconditions:	none
+	//	Postconditions:	the sums of the counters and times of the rows and single
+	//					queries are returned, all 0 without DIJKSTRA_STATS. graph object
+	//					is not changed
+	SearchStats getSearchStats() const;
+
+
+	//-----------------------------  resetSearchStats  -------------------------------------
+	//	Sets the counters getSearchStats returns back to 0
+	//	Preconditions:	none
+	//	Postconditions:	every counter and time of the totals is 0
+	void resetSearchStats();
+
+
+private:
 	struct EdgeNode {
 		int adjVertex;			// subscript of the adjacent vertex 
 		int weight;				// weight of edge
@@ -159,36 +783,280 @@ private:
 
 	struct VertexNode {
 		EdgeNode* edgeHead;		// head of the list of edges
-		Vertex* data;			// store vertex data here
 	};
 
-	// array of VertexNodes
-	VertexNode vertices[MAX_VERTICES];
+	// position of a vertex for the Euclidean heuristic
+	struct Location {
+		double x;
+		double y;
+		bool located;			// false until setCoordinates gives the vertex a position
+	};
+
+	// first bytes of a snapshot file. it is followed by the vertex description
+	// offsets (int64, size + 2 of them), the forward offsets, adjacent vertices and
+	// weights, the same three arrays for the reverse adjacency (int32), and last
+	// the description characters
+	struct SnapshotHeader {
+		char magic[8];			// "DIJKSNAP"
+		uint32_t version;		// SNAPSHOT_VERSION
+		uint32_t byteOrder;		// SNAPSHOT_BYTE_ORDER as written by the saving machine
+		int32_t vertexCount;	// size
+		int32_t edgeCount;		// number of edges
+		uint64_t textBytes;		// number of description characters
+		uint64_t fileBytes;		// length of the whole file
+	};
+
+	static const uint32_t SNAPSHOT_VERSION = 1;
+	static const uint32_t SNAPSHOT_BYTE_ORDER = 0x01020304;
 
-	// table of information for Dijkstra's algorithm
-	struct Table {
-		bool visited;			// whether vertex has been visited
-		int dist;				// shortest known distance from source
-		int path;				// previous vertex in path of min dist
+	// one edge as read from the input, before it is linked into the graph
+	struct EdgeRecord {
+		int source;				// subscript of the source vertex
+		int destination;		// subscript of the destination vertex
+		int weight;				// weight of edge
+	};
+
+	// array of VertexNodes, subscripts 1 to size are used
+	vector<VertexNode> vertices;
+
+	// every EdgeNode of the graph is carved out of this
+	NodePool<EdgeNode> edgePool;
+
+	// descriptions of the vertices, entries 1 to size are used. copies of the graph
+	// share it
+	shared_ptr<const DescriptionArena> descriptions;
+
+	// positions of the vertices, subscripts 1 to size are used. nullptr until a
+	// position is set, and shared by copies of the graph until one of them sets
+	// another
+	shared_ptr<vector<Location>> locations;
+
+	// frozen copy of the adjacency lists that queries run against, and the same
+	// edges turned around for searching backward from a destination. const queries
+	// rebuild them when they are stale, one at a time under freezeLock
+	mutable CSRGraph adjacency;
+	mutable CSRGraph reverseAdjacency;
+	mutable atomic<bool> adjacencyStale;	// adjacency lists changed since adjacency was built
+
+	// adjacency with 16 bit subscripts and weights, built by prepareTable for the
+	// heap and radix heap rows when the graph fits them
+	typedef CompactAdjacency<uint16_t, uint16_t> SmallAdjacency;
+	SmallAdjacency smallAdjacency;
+	mutable mutex freezeLock;	// held while a const query rebuilds adjacency
+	bool adjacencyListsMissing;	// loaded from a snapshot or shared by a copy, lists not
+								// built from adjacency yet
+	bool sharedTopology;		// copies share adjacency instead of copying the lists
+
+	// table of information for Dijkstra's algorithm from one source, kept as one
+	// array per field so a scan over the distances reads nothing else
+	struct TableRow {
+		vector<Distance> dist;	// shortest known distance from source
+		vector<int> path;		// previous vertex in path of min dist
+		vector<uint64_t> visited;	// whether vertex has been visited, one bit each
+
+		// whether the row has been computed
+		bool empty() const { return dist.empty(); }
+
+		// whether vertex has been visited
+		bool isVisited(int vertex) const { return (visited[vertex >> 6] >> (vertex & 63)) & 1; }
+
+		// marks vertex as visited
+		void markVisited(int vertex) { visited[vertex >> 6] |= uint64_t(1) << (vertex & 63); }
 	};
 
 	int size;					// number of vertices in the graph
+	int edgeCount;				// number of edges in the graph
+	QueueStrategy queueStrategy;	// how the next vertex is picked
+	int threadCount;			// workers used by findShortestPath, 0 for one per core
+	bool incrementalRepair;		// repair the rows of T on an edge change instead of emptying
 
 	// Table stores visited, distance, path - two dimensional in order to solve for all sources
-	Table T[MAX_VERTICES][MAX_VERTICES];
+	// one row per source vertex, a row is empty until the paths from that source are computed
+	vector<TableRow> T;
+	bool tableStale;			// an edge changed since the rows of T were computed
+
+	// search arrays reused by the single queries that are not given a workspace.
+	// a copy of the graph starts with an empty one
+	QueryWorkspace workspace;
+
+	// called after each row of T and each single query, and the sums of their
+	// counters. rows and queries on any thread add to the sums under statsLock
+	TraceCallback traceCallback;
+	mutable SearchStats totalStats;
+	mutable mutex statsLock;
 
 	
+	//-------------------------------  prepareTable  --------------------------------------
+	//	Gets Table T and the compressed adjacency ready for computing rows
+	//	Preconditions:	none
+	//	Postconditions:	T has one row per vertex. if an edge changed since the rows were
+	//					computed, every row is emptied. adjacency is up to date, and
+	//					so is smallAdjacency if the strategy reads it and the graph fits
+	void prepareTable();
+
+
+	//---------------------------  prepareSmallAdjacency  ---------------------------------
+	//	Brings the 16 bit copy of adjacency up to date
+	//	Preconditions:	adjacency is up to date
+	//	Postconditions:	smallAdjacency is a copy of adjacency if the graph fits it,
+	//					otherwise it is empty
+	void prepareSmallAdjacency();
+
+
+	//--------------------------------  computeRow  ---------------------------------------
+	//	Computes the shortest paths from a source vertex if they are not cached
+	//	Preconditions:	prepareTable has been called. source is a vertex in the graph
+	//	Postconditions:	row source of Table T holds the shortest distance and the path
+	//					from source to every vertex. a cached row is not computed again
+	void computeRow(int source);
+
+
+	//-------------------------------  repairTable  ---------------------------------------
+	//	Brings the cached rows of Table T up to date after the weight of an edge changed
+	//	Preconditions:	the adjacency lists hold the changed edge. oldWeight and newWeight
+	//					are the weight before and after the change, INT_MAX for no edge
+	//	Postconditions:	if incrementalRepair is false, every row is marked stale. 
+	//					otherwise rows the change shortens are repaired in place, rows
+	//					whose shortest path tree used the edge are emptied, and the rest
+	//					are kept as they are
+	void repairTable(int sourceVertex, int destinationVertex, int oldWeight, int newWeight);
+
+
+	//----------------------------  propagateDecrease  ------------------------------------
+	//	Spreads a shortened distance through one cached row of Table T
+	//	Preconditions:	row source of T is cached, and vertex has just been given a
+	//					shorter distance in it. frontier is empty
+	//	Postconditions:	every vertex whose distance from source got shorter through
+	//					vertex has its distance and path updated. frontier is empty
+	void propagateDecrease(int source, int vertex, IndexedHeap& frontier);
+
+
 	//--------------------------  findShortestPathHelper  ----------------------------------
 	//	A helper function to findShortestPath that runs Dijkstra's Algorithm from a 
 	//	source vertex
 	//	Preconditions:	the value being passed in as a parameter to the function is an 
-	//					integer. the private member Table T has been initialized.
+	//					integer. row source of Table T has been initialized.
 	//	Postconditions:	Dijkstra's Algorithm is ran to every available destination vertex
 	//					from the source vertex. if a shorter path is found to the 
 	//					destination vertex then Table T is updated to reflect the newly
 	//					discovered lowest weight and the path it came from.
-	//
-	void findShortestPathHelper(int source);
+	//					what the search did is added to stats
+	void findShortestPathHelper(int source, SearchStats& stats);
+
+
+	//--------------------------  findShortestPathLinear  ----------------------------------
+	//	Runs Dijkstra's Algorithm from a source vertex, picking the next vertex with a
+	//	linear scan of the table row
+	//	Preconditions:	the value being passed in as a parameter to the function is an 
+	//					integer. the private member Table T has been initialized.
+	//	Postconditions:	row source of Table T holds the shortest distance and the path
+	//					from source to every vertex that can be reached
+	//					the counts of the search are added to stats
+	void findShortestPathLinear(int source, SearchStats& stats);
+
+
+	//--------------------------  findShortestPathVector  ----------------------------------
+	//	Runs Dijkstra's Algorithm from a source vertex, picking the next vertex with a
+	//	vectorized scan of the keys of the unvisited vertices
+	//	Preconditions:	the value being passed in as a parameter to the function is an 
+	//					integer. the private member Table T has been initialized.
+	//	Postconditions:	row source of Table T holds the same distances and paths as
+	//					findShortestPathLinear gives
+	//					the counts of the search are added to stats
+	void findShortestPathVector(int source, SearchStats& stats);
+
+
+	//---------------------------  findShortestPathHeap  -----------------------------------
+	//	Runs Dijkstra's Algorithm from a source vertex, picking the next vertex from an
+	//	indexed binary heap of the vertices reached so far
+	//	Preconditions:	the value being passed in as a parameter to the function is an 
+	//					integer. the private member Table T has been initialized.
+	//	Postconditions:	row source of Table T holds the shortest distance and the path
+	//					from source to every vertex that can be reached
+	//					the counts of the search are added to stats
+	void findShortestPathHeap(int source, SearchStats& stats);
+
+
+	//---------------------------  findShortestPathRadix  ----------------------------------
+	//	Runs Dijkstra's Algorithm from a source vertex, picking the next vertex from a
+	//	radix heap of the vertices reached so far
+	//	Preconditions:	the value being passed in as a parameter to the function is an 
+	//					integer. the private member Table T has been initialized.
+	//	Postconditions:	row source of Table T holds the shortest distance and a
+	//					shortest path from source to every vertex that can be reached
+	//					the counts of the search are added to stats
+	void findShortestPathRadix(int source, SearchStats& stats);
+
+
+	//---------------------------  findShortestPathDelta  ----------------------------------
+	//	Finds the shortest paths from a source vertex by delta stepping. vertices are
+	//	kept in buckets of distances delta wide, and each bucket is settled by
+	//	relaxing the light edges of its vertices until it stays empty, then their
+	//	heavy edges once
+	//	Preconditions:	the value being passed in as a parameter to the function is an 
+	//					integer. the private member Table T has been initialized.
+	//	Postconditions:	row source of Table T holds the shortest distance and a
+	//					shortest path from source to every vertex that can be reached.
+	//					delta is the mean edge weight, and the edges of a bucket are
+	//					relaxed on up to threadCount workers, one for every EDGE_GRAIN
+	//					edges
+	//					the counts of the search are added to stats
+	void findShortestPathDelta(int source, SearchStats& stats);
+
+
+	//--------------------------------  runDijkstra  --------------------------------------
+	//	Runs Dijkstra's Algorithm from a source vertex, compiled for one edge storage,
+	//	one frontier policy and whether the paths are kept
+	//	Preconditions:	every distance of row is NO_DISTANCE and no vertex of it is
+	//					visited. if TRACK_PATHS, row.path has an entry for every vertex.
+	//					frontier is empty and holds every vertex subscript of edges
+	//	Postconditions:	row holds the shortest distance from source to every vertex
+	//					that can be reached along edges and, if TRACK_PATHS, the vertex
+	//					before each one on a shortest path. frontier is empty. the
+	//					counts of the search are added to stats
+	template <bool TRACK_PATHS, class Adjacency, class Queue>
+	static void runDijkstra(int source, const Adjacency& edges, TableRow& row, Queue& frontier,
+		SearchStats& stats);
+
+
+	//--------------------------------  searchRows  ---------------------------------------
+	//	Runs Dijkstra's Algorithm from each of a list of sources outside Table T, with
+	//	one row and one frontier per worker reused from source to source
+	//	Preconditions:	edges has a row for every vertex subscript of the graph
+	//	Postconditions:	store(i, row) is called once for each subscript i of sources,
+	//					with row holding the distances from sources[i] along edges
+	//					and, if TRACK_PATHS, the vertex before each vertex reached.
+	//					the calls run on as many threads as setThreadCount allows, each
+	//					with a row of its own. Table T is not changed
+	template <bool TRACK_PATHS, class Adjacency, class Queue, class Store>
+	void searchRows(const vector<int>& sources, const Adjacency& edges, const Store& store) const;
+
+
+	//-----------------------------  searchRowsAlong  -------------------------------------
+	//	Runs searchRows along adjacency or reverseAdjacency with the storage and the
+	//	frontier the queue strategy picks
+	//	Preconditions:	the compressed adjacency and smallAdjacency are up to date
+	//	Postconditions:	the same as searchRows. forward rows read smallAdjacency when it
+	//					is built, and the rows use the radix heap with RADIX_HEAP and
+	//					the binary heap for every other strategy
+	template <bool TRACK_PATHS, class Store>
+	void searchRowsAlong(const vector<int>& sources, bool reverse, const Store& store) const;
+
+
+	//----------------------------  sourceThreadCount  ------------------------------------
+	//	Returns how many workers the source vertices are spread over
+	//	Preconditions:	none
+	//	Postconditions:	threadCount is returned, or 1 with DELTA_STEPPING, which uses
+	//					the workers inside each source
+	int sourceThreadCount() const;
+
+
+	//--------------------------------  useHeap  ------------------------------------------
+	//	Decides whether the binary heap or a scan of the row is used for this graph
+	//	Preconditions:	size and edgeCount are up to date
+	//	Postconditions:	true is returned if the heap should be used. for AUTO_QUEUE the
+	//					heap is used while E * log2(V) is less than V * V
+	bool useHeap() const;
 
 	
 	//----------------------------  lowestWeightVertex  ------------------------------------
@@ -199,8 +1067,195 @@ private:
 	//					by the findShortestPath algorithm.
 	//	Postconditions: no changes made to the Graph object. the vertex that has not been
 	//					visited and has the lowest weight is returned to the calling
-	//					object. If no vertex is found, then 0 is returned.
-	int lowestWeightVertex(int source) const;
+	//					object. If no vertex is found, then 0 is returned. the entries
+	//					read are counted in stats
+	int lowestWeightVertex(int source, SearchStats& stats) const;
+
+
+	//-------------------------------  recordSearch  --------------------------------------
+	//	Adds what one search did to the totals and hands it to the trace callback
+	//	Preconditions:	trace holds the counters of a search that has finished
+	//	Postconditions:	the counters of trace are added to totalStats, and traceCallback
+	//					is called with trace if it is set
+	void recordSearch(const QueryTrace& trace) const;
+
+	
+	//---------------------------  unidirectionalSearch  -----------------------------------
+	//	Finds the shortest path from source to destination with one search that stops
+	//	once destination is settled
+	//	Preconditions:	source and destination are vertices in the graph. adjacency is
+	//					up to date. workspace has been prepared for size vertices
+	//	Postconditions:	the distance, the path and the number of vertices settled are
+	//					returned. graph object is not changed
+	PathResult unidirectionalSearch(int source, int destination, QueryWorkspace& workspace) const;
+
+
+	//---------------------------------  searchFrom  --------------------------------------
+	//	Runs Dijkstra's Algorithm from a source vertex in a search state
+	//	Preconditions:	source is a vertex in the graph. adjacency is up to date. state
+	//					has been prepared for size vertices
+	//	Postconditions:	vertices are settled in order of distance until destination is
+	//					settled, or every vertex source reaches if destination is 0. state
+	//					holds the distance and previous vertex of each vertex reached. the
+	//					number of vertices settled is returned. graph object is not changed
+	int searchFrom(int source, int destination, SearchState& state) const;
+
+
+	//-----------------------------  searchFromSources  -----------------------------------
+	//	Runs Dijkstra's Algorithm from several source vertices at once in a search state
+	//	Preconditions:	adjacency is up to date. state has been prepared for size
+	//					vertices. targets is sorted and holds no vertex twice
+	//	Postconditions:	each source in the graph with an offset of 0 or more is reached
+	//					at its offset, as its own previous vertex. vertices are settled in
+	//					order of distance until every vertex of targets is settled, or
+	//					until the frontier holds nothing within limit if targets is
+	//					empty. if settledOrder is not nullptr, each vertex settled is
+	//					added to it with its distance. the number of vertices settled is
+	//					returned. graph object is not changed
+	int searchFromSources(const vector<SearchSource>& sources, const vector<int>& targets,
+		Distance limit, SearchState& state, vector<VertexDistance>* settledOrder) const;
+
+
+	//---------------------------------  relaxEdges  --------------------------------------
+	//	Relaxes the edges leaving a settled vertex of a search
+	//	Preconditions:	vertex has just been settled in state. adjacency is up to date
+	//	Postconditions:	every vertex adjacent to vertex that is not settled and gets a
+	//					shorter distance through it is reached from vertex and is on the
+	//					frontier of state with that distance
+	void relaxEdges(int vertex, SearchState& state) const;
+
+
+	//---------------------------------  traceLinks  --------------------------------------
+	//	Rebuilds a path from the previous vertices of a search state, without recursion
+	//	Preconditions:	state holds a search from source
+	//	Postconditions:	path holds the vertices from source to destination in order of
+	//					travel, or is empty if state has not reached destination
+	static void traceLinks(const SearchState& state, int source, int destination, vector<int>& path);
+
+
+	//--------------------------------  traceToRoot  --------------------------------------
+	//	Rebuilds a path from the previous vertices of a search started from several
+	//	sources, back to the source it came from
+	//	Preconditions:	each source of the search in state is its own previous vertex
+	//	Postconditions:	path holds the vertices from the source destination was reached
+	//					from to destination in order of travel, or is empty if state has
+	//					not reached destination
+	static void traceToRoot(const SearchState& state, int destination, vector<int>& path);
+
+
+	//---------------------------  bidirectionalSearch  ------------------------------------
+	//	Finds the shortest path from source to destination by searching forward from
+	//	source and backward from destination until the two searches meet
+	//	Preconditions:	source and destination are vertices in the graph. adjacency and
+	//					reverseAdjacency are up to date. workspace has been prepared for
+	//					size vertices
+	//	Postconditions:	the distance, the path and the number of vertices settled by
+	//					both searches are returned. graph object is not changed
+	PathResult bidirectionalSearch(int source, int destination, QueryWorkspace& workspace) const;
+
+
+	//--------------------------------  settleNext  ---------------------------------------
+	//	Settles the next vertex of one side of a bidirectional search and relaxes its
+	//	edges, recording any path that joins this side to the other side
+	//	Preconditions:	the frontier of side is not empty. edges is the adjacency this
+	//					side searches. other is the state of the other side
+	//	Postconditions:	one vertex is settled. if a joined path shorter than best is
+	//					found, best and meet are updated to it
+	static void settleNext(SearchState& side, const CSRGraph& edges, const SearchState& other,
+		long long& best, int& meet);
+
+
+	//--------------------------------  aStarSearch  --------------------------------------
+	//	Finds the shortest path from source to destination with an A* search
+	//	Preconditions:	source and destination are vertices in the graph. adjacency is
+	//					up to date. workspace has been prepared for size vertices.
+	//					heuristic never estimates more than the distance left
+	//	Postconditions:	the distance, the path and the number of vertices taken off the
+	//					frontier are returned. graph object is not changed
+	PathResult aStarSearch(int source, int destination, const Heuristic& heuristic,
+		QueryWorkspace& workspace) const;
+
+
+	//--------------------------------  scanInt  ------------------------------------------
+	//	Reads one integer straight from the buffer of a stream, skipping white space
+	//	Preconditions:	buffer is the stream buffer of in
+	//	Postconditions:	true is returned and value holds the integer if one was read.
+	//					eofbit is set on in if the end of the input was reached and 
+	//					failbit if no integer could be read, as operator>> would do
+	static bool scanInt(istream& in, streambuf& buffer, int& value);
+
+
+	//----------------------------  bulkInsertEdges  --------------------------------------
+	//	Links a whole set of edges into the adjacency lists at once
+	//	Preconditions:	the adjacency lists are empty. size is up to date
+	//	Postconditions:	the edges are sorted by source and destination. edges with a
+	//					negative weight or a vertex outside the graph are skipped, and
+	//					for an edge listed more than once the last weight is kept, the
+	//					same as calling insertEdge for each edge in order
+	void bulkInsertEdges(vector<EdgeRecord>& edges);
+
+
+	//----------------------------  freezeAdjacency  --------------------------------------
+	//	Rebuilds the compressed sparse row copy of the adjacency lists if it is stale
+	//	Preconditions:	vertices.edgeHead points to the head of each list
+	//	Postconditions:	adjacency holds the same edges as the adjacency lists, in the
+	//					same order, and adjacencyStale is false. when several const queries
+	//					find it stale at once, one of them rebuilds it and the others wait
+	//					for it
+	void freezeAdjacency() const;
+
+
+	//-----------------------------  thawAdjacency  ---------------------------------------
+	//	Builds the adjacency lists from the compressed adjacency when a snapshot was
+	//	loaded and the lists have not been needed yet
+	//	Preconditions:	adjacency is up to date
+	//	Postconditions:	the adjacency lists hold the same edges as adjacency and
+	//					adjacencyListsMissing is false
+	void thawAdjacency();
+
+
+	//------------------------------  snapshotBytes  --------------------------------------
+	//	Computes the length of a snapshot file
+	//	Preconditions:	vertexCount and edgeCount are greater than or equal to 0
+	//	Postconditions:	the number of bytes in a snapshot with these counts is returned
+	static uint64_t snapshotBytes(int vertexCount, int edgeCount, uint64_t textBytes);
+
+
+	//----------------------------  validTextOffsets  -------------------------------------
+	//	Checks the description offsets of a snapshot
+	//	Preconditions:	offsets holds vertexCount + 2 entries
+	//	Postconditions:	true is returned if the offsets start at 0, never decrease and
+	//					end no later than textBytes, otherwise false
+	static bool validTextOffsets(const int64_t* offsets, int vertexCount, uint64_t textBytes);
+
+
+	//------------------------------  validSection  ---------------------------------------
+	//	Checks one adjacency section of a snapshot
+	//	Preconditions:	offsets holds vertexCount + 2 entries, and adjVertex and weight
+	//					hold edgeCount entries
+	//	Postconditions:	true is returned if the offsets start at 0, never decrease and
+	//					end at edgeCount, every adjacent vertex is in the range 1 to
+	//					vertexCount and no weight is negative, otherwise false
+	static bool validSection(const int* offsets, const int* adjVertex, const int* weight,
+		int vertexCount, int edgeCount);
+
+
+	//-----------------------------  validTranspose  --------------------------------------
+	//	Checks that the reverse section of a snapshot matches the forward one
+	//	Preconditions:	both sections passed validSection with the same vertexCount
+	//	Postconditions:	true is returned if each vertex has as many edges into it in
+	//					the forward section as it has in its row of the reverse section,
+	//					and the other way around, otherwise false
+	static bool validTranspose(const int* forwardOffsets, const int* forwardAdjVertex,
+		const int* reverseOffsets, const int* reverseAdjVertex, int vertexCount);
+
+
+	//--------------------------------  isVertex  -----------------------------------------
+	//	Checks whether a vertex subscript refers to a vertex in the graph
+	//	Preconditions:	none
+	//	Postconditions:	true is returned if vertex is in the range 1 to size, otherwise
+	//					false. graph object is not changed
+	bool isVertex(int vertex) const;
 
 	
 	//------------------------------  clearGraph  ------------------------------------------
@@ -212,25 +1267,45 @@ private:
 	void clearGraph();
 
 	
+	//--------------------------------  tracePath  ----------------------------------------
+	//	Rebuilds a path from the previous vertices in a row of Table T, without recursion
+	//	Preconditions:	buffer holds capacity ints
+	//	Postconditions:	the number of vertices from source to destination is returned,
+	//					0 if there is no path, either vertex is not in the graph or row
+	//					source of Table T is not cached. if it is no more than capacity,
+	//					buffer holds the path in order of travel. graph object is not
+	//					changed
+	int tracePath(int source, int destination, int* buffer, int capacity) const;
+
+
 	//--------------------------------  printPath  ----------------------------------------
-	//	A helper method that recursively finds the path from a source vertex to a destination
-	//	vertex
-	//	Preconditions:	the parameters passed in are integer values. Table T is updated.		
-	//	Postconditions:	the destination is printed recursively for each source vertex, 
-	//					resulting in a path from a source vertex to a destination vertex.
-	//					graph object is not changed.
-	void printPath(const int& source,const int& destination) const;
+	//	A helper method that prints the path from a source vertex to a destination vertex
+	//	Preconditions:	path holds the vertices of a path in order of travel, or is empty
+	//					if there is no path
+	//	Postconditions:	each vertex of the path is printed in order of travel, resulting
+	//					in a path from a source vertex to a destination vertex. graph
+	//					object is not changed.
+	void printPath(const vector<int>& path) const;
 
 	
 	//------------------------  printLocationDescriptions  --------------------------------
-	//	A helper method that recursively finds the path location descriptions from a 
-	//	source vertex to a destination vertex
-	//	Preconditions:	the parameters passed in are integer values. all vertex pointers
-	//					in vertexNode point to a vertex object. Table T is updated
-	//	Postconditions:	the destination path is travelled recursively and once done, prints
-	//					vertex data in recursive fashion. this results in a detailed path
-	//					description printed in order of travel. graph object is not changed
-	void printLocationDescriptions(const int& source, const int& destination) const;
+	//	A helper method that prints the location descriptions along a path
+	//	Preconditions:	path holds the vertices of a path in order of travel, or is empty
+	//					if there is no path. every vertex has a description
+	//	Postconditions:	the vertex data of each vertex of the path is printed. this results
+	//					in a detailed path description printed in order of travel. graph
+	//					object is not changed
+	void printLocationDescriptions(const vector<int>& path) const;
+
+
+	//--------------------------------  printDetails  -------------------------------------
+	//	Prints the line and the descriptions of a single path, the way display lays it out
+	//	Preconditions:	path holds the vertices from source to destination, or is empty
+	//					if distance is NO_DISTANCE
+	//	Postconditions:	the source vertex, destination vertex, distance and path are
+	//					printed on one line and the description of each vertex of the path
+	//					on the lines after it. graph object is not changed
+	void printDetails(int source, int destination, Distance distance, const vector<int>& path) const;
 
 
 	//--------------------------------  copyGraph  ----------------------------------------
@@ -241,6 +1316,17 @@ private:
 	//					to match fromGraph before the copyGraph function was called.
 	//	Postconditions:	a deep copy is made of the fromGraph into this Graph object.
 	//					this should now be identical to fromGraph. the table is updated
-	//					to match the table in fromGraph
+	//					to match the table in fromGraph. if sharedTopology is true and
+	//					the compressed adjacency of fromGraph is up to date, it is shared
+	//					instead and the lists and the table are not copied
 	void copyGraph(const Graph& fromGraph);
+
+
+	//--------------------------------  moveGraph  ----------------------------------------
+	//	Helper method that move constructor and move assignment operator use to take
+	//	the contents of a graph
+	//	Preconditions:	this Graph object is empty. fromGraph is not this object
+	//	Postconditions:	this Graph object holds what fromGraph held and fromGraph is
+	//					empty. no EdgeNode, description or table row is copied
+	void moveGraph(Graph& fromGraph);
 };
@@ -0,0 +1,313 @@
+//---------------------------------------------------------------------------------
+// IndexedHeap.h
+// Author: Brent Barrese
+// Class Declarations and Definitions
+//---------------------------------------------------------------------------------
+// BasicIndexedHeap Class:	An indexed binary min heap of vertex subscripts keyed
+//							by their tentative distance, with the subscripts
+//							stored as Index. Used by the Graph class as the
+//							frontier of Dijkstra's Algorithm on sparse graphs.
+// IndexedHeap:				The heap with int subscripts.
+//
+//   --	allows inserting a vertex with a key
+//   --	allows lowering the key of a vertex that is already in the heap
+//   --	allows removing the vertex with the lowest key
+//   --	allows checking whether a vertex is currently in the heap
+//   --	allows reading the lowest key without removing its vertex
+//   --	keeps its arrays as narrow as Index, so a small graph can use a heap of
+//		16 bit subscripts that takes half the cache of one of int
+//
+// Assumptions:
+//   -- vertex subscripts are in the range 0 to capacity - 1
+//   -- a vertex is in the heap at most once
+//   -- ties between equal keys are broken by the lower vertex subscript, so the
+//		heap settles vertices in the same order as a linear scan would
+//   -- capacity is less than the largest value of Index, which marks a vertex
+//		that is not in the heap
+//   -- being a template, the definitions are in this header
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "Distance.h"
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+template <typename Index>
+class BasicIndexedHeap {
+public:
+	//-------------------------------  constructor  ----------------------------------
+	//	Constructor for the BasicIndexedHeap class
+	//	Preconditions:	capacity is greater than or equal to 0
+	//	Postconditions:	an empty heap is created that can hold the vertex subscripts
+	//					0 to capacity - 1
+	explicit BasicIndexedHeap(int capacity);
+
+
+	//--------------------------------  isEmpty  -------------------------------------
+	//	Checks whether the heap has any vertices in it
+	//	Preconditions:	none
+	//	Postconditions:	true is returned if the heap is empty, otherwise false
+	bool isEmpty() const;
+
+
+	//--------------------------------  contains  ------------------------------------
+	//	Checks whether a vertex is currently in the heap
+	//	Preconditions:	vertex is in the range 0 to capacity - 1
+	//	Postconditions:	true is returned if vertex is in the heap, otherwise false
+	bool contains(Index vertex) const;
+
+
+	//----------------------------------  push  --------------------------------------
+	//	Inserts a vertex into the heap with the given key
+	//	Preconditions:	vertex is in the range 0 to capacity - 1 and is not already
+	//					in the heap
+	//	Postconditions:	vertex is in the heap and the heap order is restored
+	void push(Index vertex, Distance key);
+
+
+	//-------------------------------  decreaseKey  ----------------------------------
+	//	Lowers the key of a vertex that is already in the heap
+	//	Preconditions:	vertex is in the heap. key is not greater than its current key
+	//	Postconditions:	the key of vertex is updated and the heap order is restored
+	void decreaseKey(Index vertex, Distance key);
+
+
+	//---------------------------------  popMin  -------------------------------------
+	//	Removes the vertex with the lowest key from the heap
+	//	Preconditions:	the heap is not empty
+	//	Postconditions:	the vertex with the lowest key is removed and returned
+	Index popMin();
+
+
+	//---------------------------------  minKey  -------------------------------------
+	//	Returns the lowest key in the heap without removing its vertex
+	//	Preconditions:	the heap is not empty
+	//	Postconditions:	the lowest key is returned. the heap is not changed
+	Distance minKey() const;
+
+
+	//---------------------------------  clear  --------------------------------------
+	//	Removes every vertex from the heap
+	//	Preconditions:	none
+	//	Postconditions:	the heap is empty. the capacity is not changed
+	void clear();
+
+private:
+	vector<Index> heap;			// vertex subscripts in heap order
+	vector<Index> position;		// index of each vertex in heap, NOT_IN_HEAP if not in heap
+	vector<Distance> keys;		// key of each vertex in the heap
+
+	static const Index NOT_IN_HEAP = numeric_limits<Index>::max();
+
+
+	//---------------------------------  less  ---------------------------------------
+	//	Compares the vertices stored at two heap indices
+	//	Preconditions:	a and b are valid indices into heap
+	//	Postconditions:	true is returned if the vertex at a belongs above the vertex
+	//					at b. ties are broken by the lower vertex subscript
+	bool less(int a, int b) const;
+
+
+	//---------------------------------  siftUp  -------------------------------------
+	//	Moves the vertex at index up the heap until the heap order is restored
+	//	Preconditions:	index is a valid index into heap
+	//	Postconditions:	the heap order is restored and position is kept updated
+	void siftUp(int index);
+
+
+	//--------------------------------  siftDown  ------------------------------------
+	//	Moves the vertex at index down the heap until the heap order is restored
+	//	Preconditions:	index is a valid index into heap
+	//	Postconditions:	the heap order is restored and position is kept updated
+	void siftDown(int index);
+
+
+	//---------------------------------  swapAt  -------------------------------------
+	//	Swaps the vertices stored at two heap indices
+	//	Preconditions:	a and b are valid indices into heap
+	//	Postconditions:	the vertices are swapped and position is kept updated
+	void swapAt(int a, int b);
+};
+
+
+// the mark in position of a vertex that is not in the heap
+template <typename Index>
+const Index BasicIndexedHeap<Index>::NOT_IN_HEAP;
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Constructor for the BasicIndexedHeap class
+//	Preconditions:	capacity is greater than or equal to 0
+//	Postconditions:	an empty heap is created that can hold the vertex subscripts
+//					0 to capacity - 1
+template <typename Index>
+BasicIndexedHeap<Index>::BasicIndexedHeap(int capacity) : position(capacity, NOT_IN_HEAP), keys(capacity, 0) {
+	heap.reserve(capacity);
+}
+
+
+//--------------------------------  isEmpty  -------------------------------------
+//	Checks whether the heap has any vertices in it
+//	Preconditions:	none
+//	Postconditions:	true is returned if the heap is empty, otherwise false
+template <typename Index>
+bool BasicIndexedHeap<Index>::isEmpty() const {
+	return heap.empty();
+}
+
+
+//--------------------------------  contains  ------------------------------------
+//	Checks whether a vertex is currently in the heap
+//	Preconditions:	vertex is in the range 0 to capacity - 1
+//	Postconditions:	true is returned if vertex is in the heap, otherwise false
+template <typename Index>
+bool BasicIndexedHeap<Index>::contains(Index vertex) const {
+	return position[vertex] != NOT_IN_HEAP;
+}
+
+
+//----------------------------------  push  --------------------------------------
+//	Inserts a vertex into the heap with the given key
+//	Preconditions:	vertex is in the range 0 to capacity - 1 and is not already
+//					in the heap
+//	Postconditions:	vertex is in the heap and the heap order is restored
+template <typename Index>
+void BasicIndexedHeap<Index>::push(Index vertex, Distance key) {
+	keys[vertex] = key;
+	position[vertex] = static_cast<Index>(heap.size());
+	heap.push_back(vertex);
+	siftUp(position[vertex]);
+}
+
+
+//-------------------------------  decreaseKey  ----------------------------------
+//	Lowers the key of a vertex that is already in the heap
+//	Preconditions:	vertex is in the heap. key is not greater than its current key
+//	Postconditions:	the key of vertex is updated and the heap order is restored
+template <typename Index>
+void BasicIndexedHeap<Index>::decreaseKey(Index vertex, Distance key) {
+	keys[vertex] = key;
+	siftUp(position[vertex]);
+}
+
+
+//---------------------------------  popMin  -------------------------------------
+//	Removes the vertex with the lowest key from the heap
+//	Preconditions:	the heap is not empty
+//	Postconditions:	the vertex with the lowest key is removed and returned
+template <typename Index>
+Index BasicIndexedHeap<Index>::popMin() {
+	Index top = heap[0];
+	int last = static_cast<int>(heap.size()) - 1;
+	swapAt(0, last);
+	heap.pop_back();
+	position[top] = NOT_IN_HEAP;
+	if (!heap.empty()) {
+		siftDown(0);
+	}
+	return top;
+}
+
+
+//---------------------------------  minKey  -------------------------------------
+//	Returns the lowest key in the heap without removing its vertex
+//	Preconditions:	the heap is not empty
+//	Postconditions:	the lowest key is returned. the heap is not changed
+template <typename Index>
+Distance BasicIndexedHeap<Index>::minKey() const {
+	return keys[heap[0]];
+}
+
+
+//---------------------------------  clear  --------------------------------------
+//	Removes every vertex from the heap
+//	Preconditions:	none
+//	Postconditions:	the heap is empty. the capacity is not changed
+template <typename Index>
+void BasicIndexedHeap<Index>::clear() {
+	for (Index vertex : heap) {
+		position[vertex] = NOT_IN_HEAP;
+	}
+	heap.clear();
+}
+
+
+//---------------------------------  less  ---------------------------------------
+//	Compares the vertices stored at two heap indices
+//	Preconditions:	a and b are valid indices into heap
+//	Postconditions:	true is returned if the vertex at a belongs above the vertex
+//					at b. ties are broken by the lower vertex subscript
+template <typename Index>
+bool BasicIndexedHeap<Index>::less(int a, int b) const {
+	Index vertexA = heap[a];
+	Index vertexB = heap[b];
+	if (keys[vertexA] != keys[vertexB]) {
+		return keys[vertexA] < keys[vertexB];
+	}
+	return vertexA < vertexB;
+}
+
+
+//---------------------------------  siftUp  -------------------------------------
+//	Moves the vertex at index up the heap until the heap order is restored
+//	Preconditions:	index is a valid index into heap
+//	Postconditions:	the heap order is restored and position is kept updated
+template <typename Index>
+void BasicIndexedHeap<Index>::siftUp(int index) {
+	while (index > 0) {
+		int parent = (index - 1) / 2;
+		if (!less(index, parent)) {
+			return;
+		}
+		swapAt(index, parent);
+		index = parent;
+	}
+}
+
+
+//--------------------------------  siftDown  ------------------------------------
+//	Moves the vertex at index down the heap until the heap order is restored
+//	Preconditions:	index is a valid index into heap
+//	Postconditions:	the heap order is restored and position is kept updated
+template <typename Index>
+void BasicIndexedHeap<Index>::siftDown(int index) {
+	int count = static_cast<int>(heap.size());
+	for (;;) {
+		int smallest = index;
+		int left = 2 * index + 1;
+		int right = left + 1;
+		if (left < count && less(left, smallest)) {
+			smallest = left;
+		}
+		if (right < count && less(right, smallest)) {
+			smallest = right;
+		}
+		if (smallest == index) {
+			return;
+		}
+		swapAt(index, smallest);
+		index = smallest;
+	}
+}
+
+
+//---------------------------------  swapAt  -------------------------------------
+//	Swaps the vertices stored at two heap indices
+//	Preconditions:	a and b are valid indices into heap
+//	Postconditions:	the vertices are swapped and position is kept updated
+template <typename Index>
+void BasicIndexedHeap<Index>::swapAt(int a, int b) {
+	Index temp = heap[a];
+	heap[a] = heap[b];
+	heap[b] = temp;
+	position[heap[a]] = static_cast<Index>(a);
+	position[heap[b]] = static_cast<Index>(b);
+}
+
+
+// the heap the searches use unless they pick a narrower one
+typedef BasicIndexedHeap<int> IndexedHeap;
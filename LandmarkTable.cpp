@@ -0,0 +1,237 @@
+//---------------------------------------------------------------------------------
+// LandmarkTable.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// LandmarkTable Class:	Holds the shortest distances from and to a few chosen
+//						landmark vertices, and turns them into lower bounds on the
+//						distance between any two vertices with the triangle
+//						inequality. Used by the Graph class to guide an A* search
+//						toward its destination (the ALT heuristic).
+//
+//   --	allows sizing the table for a number of vertices and a list of landmarks
+//   --	allows storing the distances from and to one landmark at a time
+//   --	allows finding a lower bound on the distance from one vertex to another
+//   --	allows saving the table to a binary file and loading it back, tagged with
+//		a fingerprint of the graph it was computed for
+//
+// Assumptions:
+//   -- vertex subscripts are in the range 0 to vertexCount - 1
+//   -- the distances of one vertex to every landmark are stored next to each
+//		other, so a lower bound reads two short runs of the table
+//   -- the bounds only hold for the edges the distances were computed on, the
+//		table is rebuilt when an edge changes
+//   -- a table file starts with a FileHeader, followed by the landmarks (int32)
+//		and the two distance arrays in the order they are kept in memory, in the
+//		byte order and Distance width of the saving machine
+//---------------------------------------------------------------------------------
+
+
+
+#include "LandmarkTable.h"
+#include <cstring>
+#include <fstream>
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the LandmarkTable class
+//	Preconditions:	none
+//	Postconditions:	an empty table with no landmarks and no vertices is created
+LandmarkTable::LandmarkTable() {
+	vertices = 0;
+}
+
+
+//---------------------------------  reset  --------------------------------------
+//	Sizes the table for a graph and a list of landmarks
+//	Preconditions:	vertexCount is greater than or equal to 0. every landmark is in
+//					the range 0 to vertexCount - 1
+//	Postconditions:	the table holds the landmarks, and every distance from and to
+//					them is NO_DISTANCE
+void LandmarkTable::reset(int vertexCount, const vector<int>& landmarks) {
+	this->landmarks = landmarks;
+	vertices = vertexCount;
+	size_t cells = static_cast<size_t>(vertexCount) * landmarks.size();
+	fromLandmark.assign(cells, NO_DISTANCE);
+	toLandmark.assign(cells, NO_DISTANCE);
+}
+
+
+//------------------------------  setDistances  ----------------------------------
+//	Stores the distances from and to one landmark
+//	Preconditions:	landmarkSlot is in the range 0 to landmarkCount() - 1. fromDist
+//					and toDist hold vertexCount() distances each. fromDist[v] is
+//					the distance from the landmark to v and toDist[v] the distance
+//					from v to the landmark, NO_DISTANCE if there is no path
+//	Postconditions:	the distances of landmark slot landmarkSlot are replaced
+void LandmarkTable::setDistances(int landmarkSlot, const vector<Distance>& fromDist,
+	const vector<Distance>& toDist) {
+	size_t count = landmarks.size();
+	for (int v = 0; v < vertices; v++) {
+		fromLandmark[v * count + landmarkSlot] = fromDist[v];
+		toLandmark[v * count + landmarkSlot] = toDist[v];
+	}
+}
+
+
+//-------------------------------  lowerBound  -----------------------------------
+//	Finds a lower bound on the distance from one vertex to another
+//	Preconditions:	vertex and destination are in the range 0 to vertexCount() - 1
+//	Postconditions:	a distance no longer than the shortest path from vertex to
+//					destination is returned. NO_DISTANCE is returned when the
+//					landmarks prove that destination cannot be reached from vertex.
+//					0 is returned when the table has no landmarks
+Distance LandmarkTable::lowerBound(int vertex, int destination) const {
+	size_t count = landmarks.size();
+	const Distance* fromVertex = fromLandmark.data() + vertex * count;
+	const Distance* fromDestination = fromLandmark.data() + destination * count;
+	const Distance* toVertex = toLandmark.data() + vertex * count;
+	const Distance* toDestination = toLandmark.data() + destination * count;
+
+	Distance best = 0;
+	for (size_t i = 0; i < count; i++) {
+		// d(L, destination) <= d(L, vertex) + d(vertex, destination). if the
+		// landmark reaches vertex but not destination, vertex cannot either
+		if (fromVertex[i] < NO_DISTANCE) {
+			if (fromDestination[i] == NO_DISTANCE) {
+				return NO_DISTANCE;
+			}
+			if (fromDestination[i] - fromVertex[i] > best) {
+				best = fromDestination[i] - fromVertex[i];
+			}
+		}
+		// d(vertex, L) <= d(vertex, destination) + d(destination, L). if
+		// destination reaches the landmark but vertex does not, vertex cannot
+		// reach destination
+		if (toDestination[i] < NO_DISTANCE) {
+			if (toVertex[i] == NO_DISTANCE) {
+				return NO_DISTANCE;
+			}
+			if (toVertex[i] - toDestination[i] > best) {
+				best = toVertex[i] - toDestination[i];
+			}
+		}
+	}
+	return best;
+}
+
+
+//------------------------------  landmarkCount  ---------------------------------
+//	Returns the number of landmarks in the table
+//	Preconditions:	none
+//	Postconditions:	the number of landmarks is returned. table is not changed
+int LandmarkTable::landmarkCount() const {
+	return static_cast<int>(landmarks.size());
+}
+
+
+//-------------------------------  vertexCount  ----------------------------------
+//	Returns the number of vertices the table was sized for
+//	Preconditions:	none
+//	Postconditions:	the number of vertices is returned. table is not changed
+int LandmarkTable::vertexCount() const {
+	return vertices;
+}
+
+
+//--------------------------------  landmark  ------------------------------------
+//	Returns the vertex in one landmark slot
+//	Preconditions:	landmarkSlot is in the range 0 to landmarkCount() - 1
+//	Postconditions:	the subscript of the landmark vertex is returned
+int LandmarkTable::landmark(int landmarkSlot) const {
+	return landmarks[landmarkSlot];
+}
+
+
+//----------------------------------  save  --------------------------------------
+//	Writes the table to a binary file that load can read
+//	Preconditions:	fingerprint identifies the graph the table was computed for
+//	Postconditions:	the landmarks and distances are written to fileName along with
+//					fingerprint. true is returned if the file was written, otherwise
+//					false. the table is not changed
+bool LandmarkTable::save(const string& fileName, uint64_t fingerprint) const {
+	FileHeader header;
+	memcpy(header.magic, "DIJKLMRK", sizeof(header.magic));
+	header.version = FILE_VERSION;
+	header.byteOrder = FILE_BYTE_ORDER;
+	header.distanceBytes = sizeof(Distance);
+	header.vertexCount = vertices;
+	header.landmarkCount = landmarkCount();
+	header.reserved = 0;
+	header.fingerprint = fingerprint;
+	header.fileBytes = fileBytes(vertices, landmarkCount());
+
+	ofstream outfile(fileName, ios::binary | ios::trunc);
+	if (!outfile) {
+		return false;
+	}
+	outfile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	for (int landmark : landmarks) {
+		int32_t vertex = landmark;
+		outfile.write(reinterpret_cast<const char*>(&vertex), sizeof(vertex));
+	}
+	outfile.write(reinterpret_cast<const char*>(fromLandmark.data()), sizeof(Distance) * fromLandmark.size());
+	outfile.write(reinterpret_cast<const char*>(toLandmark.data()), sizeof(Distance) * toLandmark.size());
+	return static_cast<bool>(outfile.flush());
+}
+
+
+//----------------------------------  load  --------------------------------------
+//	Replaces the table with one read from a binary file
+//	Preconditions:	fileName was written by save on a machine with the same byte
+//					order
+//	Postconditions:	if the file holds a table of this version and Distance width
+//					that was saved with fingerprint, the table holds it and true is
+//					returned. otherwise false is returned and the table is not changed
+bool LandmarkTable::load(const string& fileName, uint64_t fingerprint) {
+	ifstream infile(fileName, ios::binary);
+	FileHeader header;
+	if (!infile || !infile.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+		return false;
+	}
+
+	// check the header before trusting any of the counts in it
+	infile.seekg(0, ios::end);
+	uint64_t length = static_cast<uint64_t>(infile.tellg());
+	if (memcmp(header.magic, "DIJKLMRK", sizeof(header.magic)) != 0 ||
+		header.version != FILE_VERSION || header.byteOrder != FILE_BYTE_ORDER ||
+		header.distanceBytes != sizeof(Distance) || header.fingerprint != fingerprint ||
+		header.vertexCount < 0 || header.landmarkCount < 0 || header.fileBytes != length ||
+		header.fileBytes != fileBytes(header.vertexCount, header.landmarkCount)) {
+		return false;
+	}
+
+	vector<int32_t> readLandmarks(header.landmarkCount);
+	size_t cells = static_cast<size_t>(header.vertexCount) * header.landmarkCount;
+	vector<Distance> readFrom(cells);
+	vector<Distance> readTo(cells);
+	infile.seekg(sizeof(header), ios::beg);
+	infile.read(reinterpret_cast<char*>(readLandmarks.data()), sizeof(int32_t) * readLandmarks.size());
+	infile.read(reinterpret_cast<char*>(readFrom.data()), sizeof(Distance) * cells);
+	infile.read(reinterpret_cast<char*>(readTo.data()), sizeof(Distance) * cells);
+	if (!infile) {
+		return false;
+	}
+	for (int32_t landmark : readLandmarks) {
+		if (landmark < 0 || landmark >= header.vertexCount) {
+			return false;
+		}
+	}
+
+	landmarks.assign(readLandmarks.begin(), readLandmarks.end());
+	vertices = header.vertexCount;
+	fromLandmark = move(readFrom);
+	toLandmark = move(readTo);
+	return true;
+}
+
+
+//--------------------------------  fileBytes  -----------------------------------
+//	Computes the length of a table file
+//	Preconditions:	vertexCount and landmarkCount are greater than or equal to 0
+//	Postconditions:	the number of bytes in a file with these counts is returned
+uint64_t LandmarkTable::fileBytes(int vertexCount, int landmarkCount) {
+	uint64_t cells = static_cast<uint64_t>(vertexCount) * static_cast<uint64_t>(landmarkCount);
+	return sizeof(FileHeader) + sizeof(int32_t) * static_cast<uint64_t>(landmarkCount) +
+		2 * sizeof(Distance) * cells;
+}
@@ -0,0 +1,147 @@
+//---------------------------------------------------------------------------------
+// LandmarkTable.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// LandmarkTable Class:	Holds the shortest distances from and to a few chosen
+//						landmark vertices, and turns them into lower bounds on the
+//						distance between any two vertices with the triangle
+//						inequality. Used by the Graph class to guide an A* search
+//						toward its destination (the ALT heuristic).
+//
+//   --	allows sizing the table for a number of vertices and a list of landmarks
+//   --	allows storing the distances from and to one landmark at a time
+//   --	allows finding a lower bound on the distance from one vertex to another
+//   --	allows saving the table to a binary file and loading it back, tagged with
+//		a fingerprint of the graph it was computed for
+//
+// Assumptions:
+//   -- vertex subscripts are in the range 0 to vertexCount - 1
+//   -- the distances of one vertex to every landmark are stored next to each
+//		other, so a lower bound reads two short runs of the table
+//   -- the bounds only hold for the edges the distances were computed on, the
+//		table is rebuilt when an edge changes
+//   -- a table file starts with a FileHeader, followed by the landmarks (int32)
+//		and the two distance arrays in the order they are kept in memory, in the
+//		byte order and Distance width of the saving machine
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "Distance.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class LandmarkTable {
+public:
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the LandmarkTable class
+	//	Preconditions:	none
+	//	Postconditions:	an empty table with no landmarks and no vertices is created
+	LandmarkTable();
+
+
+	//---------------------------------  reset  --------------------------------------
+	//	Sizes the table for a graph and a list of landmarks
+	//	Preconditions:	vertexCount is greater than or equal to 0. every landmark is in
+	//					the range 0 to vertexCount - 1
+	//	Postconditions:	the table holds the landmarks, and every distance from and to
+	//					them is NO_DISTANCE
+	void reset(int vertexCount, const vector<int>& landmarks);
+
+
+	//------------------------------  setDistances  ----------------------------------
+	//	Stores the distances from and to one landmark
+	//	Preconditions:	landmarkSlot is in the range 0 to landmarkCount() - 1. fromDist
+	//					and toDist hold vertexCount() distances each. fromDist[v] is
+	//					the distance from the landmark to v and toDist[v] the distance
+	//					from v to the landmark, NO_DISTANCE if there is no path
+	//	Postconditions:	the distances of landmark slot landmarkSlot are replaced
+	void setDistances(int landmarkSlot, const vector<Distance>& fromDist, const vector<Distance>& toDist);
+
+
+	//-------------------------------  lowerBound  -----------------------------------
+	//	Finds a lower bound on the distance from one vertex to another
+	//	Preconditions:	vertex and destination are in the range 0 to vertexCount() - 1
+	//	Postconditions:	a distance no longer than the shortest path from vertex to
+	//					destination is returned. NO_DISTANCE is returned when the
+	//					landmarks prove that destination cannot be reached from vertex.
+	//					0 is returned when the table has no landmarks
+	Distance lowerBound(int vertex, int destination) const;
+
+
+	//------------------------------  landmarkCount  ---------------------------------
+	//	Returns the number of landmarks in the table
+	//	Preconditions:	none
+	//	Postconditions:	the number of landmarks is returned. table is not changed
+	int landmarkCount() const;
+
+
+	//-------------------------------  vertexCount  ----------------------------------
+	//	Returns the number of vertices the table was sized for
+	//	Preconditions:	none
+	//	Postconditions:	the number of vertices is returned. table is not changed
+	int vertexCount() const;
+
+
+	//--------------------------------  landmark  ------------------------------------
+	//	Returns the vertex in one landmark slot
+	//	Preconditions:	landmarkSlot is in the range 0 to landmarkCount() - 1
+	//	Postconditions:	the subscript of the landmark vertex is returned
+	int landmark(int landmarkSlot) const;
+
+
+	//----------------------------------  save  --------------------------------------
+	//	Writes the table to a binary file that load can read
+	//	Preconditions:	fingerprint identifies the graph the table was computed for
+	//	Postconditions:	the landmarks and distances are written to fileName along with
+	//					fingerprint. true is returned if the file was written, otherwise
+	//					false. the table is not changed
+	bool save(const string& fileName, uint64_t fingerprint) const;
+
+
+	//----------------------------------  load  --------------------------------------
+	//	Replaces the table with one read from a binary file
+	//	Preconditions:	fileName was written by save on a machine with the same byte
+	//					order
+	//	Postconditions:	if the file holds a table of this version and Distance width
+	//					that was saved with fingerprint, the table holds it and true is
+	//					returned. otherwise false is returned and the table is not changed
+	bool load(const string& fileName, uint64_t fingerprint);
+
+private:
+	// first bytes of a table file
+	struct FileHeader {
+		char magic[8];			// "DIJKLMRK"
+		uint32_t version;		// FILE_VERSION
+		uint32_t byteOrder;		// FILE_BYTE_ORDER as written by the saving machine
+		uint32_t distanceBytes;	// sizeof(Distance) of the saving program
+		int32_t vertexCount;	// number of vertices the table is sized for
+		int32_t landmarkCount;	// number of landmarks
+		int32_t reserved;		// 0, keeps the header a multiple of 8 bytes
+		uint64_t fingerprint;	// fingerprint of the graph passed to save
+		uint64_t fileBytes;		// length of the whole file
+	};
+
+	static const uint32_t FILE_VERSION = 1;
+	static const uint32_t FILE_BYTE_ORDER = 0x01020304;
+
+	vector<int> landmarks;		// vertex subscript of each landmark
+	int vertices;				// number of vertices the table is sized for
+
+	// fromLandmark[v * landmarkCount() + i] is the distance from landmark i to v,
+	// toLandmark the distance from v to landmark i
+	vector<Distance> fromLandmark;
+	vector<Distance> toLandmark;
+
+
+	//--------------------------------  fileBytes  -----------------------------------
+	//	Computes the length of a table file
+	//	Preconditions:	vertexCount and landmarkCount are greater than or equal to 0
+	//	Postconditions:	the number of bytes in a file with these counts is returned
+	static uint64_t fileBytes(int vertexCount, int landmarkCount);
+};
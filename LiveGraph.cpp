@@ -0,0 +1,121 @@
+//---------------------------------------------------------------------------------
+// LiveGraph.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// LiveGraph Class:	Holds the current version of a Graph that changes while
+//					queries run on it. Readers take the version that is current
+//					and query it with the const Graph queries; writers build the
+//					next version beside it and swap it in, so a query never waits
+//					for an update and never sees one half done.
+//
+//   --	allows taking the current version, which stays valid and unchanged for
+//		as long as the reader holds on to it
+//   --	allows applying a batch of edge insertions and removals as one new
+//		version, built on a copy that shares the edges of the current one
+//   --	allows replacing the current version with a whole new graph
+//   --	frees an old version once the last reader that took it lets go of it
+//
+// Assumptions:
+//   -- versions are only changed through this class, never through a Graph a
+//		reader holds
+//   -- one writer builds a version at a time, others wait for it. readers never
+//		wait for a writer
+//   -- the version a reader took is freed on whichever thread lets go of it last
+//---------------------------------------------------------------------------------
+
+
+
+#include "LiveGraph.h"
+#include <utility>
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Constructor for the LiveGraph class
+//	Preconditions:	none
+//	Postconditions:	graph is moved into version 1, with its compressed adjacency
+//					up to date and shared by the versions built from it. graph is
+//					left empty
+LiveGraph::LiveGraph(Graph&& graph) {
+	versionNumber = 0;
+	publish(move(graph));
+}
+
+
+//--------------------------------  snapshot  ------------------------------------
+//	Returns the current version of the graph
+//	Preconditions:	none
+//	Postconditions:	the version that is current is returned. it is not changed by
+//					later updates, and is kept alive while the caller holds it.
+//					never waits for a writer
+shared_ptr<const Graph> LiveGraph::snapshot() const {
+	return atomic_load(&current);
+}
+
+
+//---------------------------------  version  ------------------------------------
+//	Returns the number of the current version
+//	Preconditions:	none
+//	Postconditions:	1 is returned before any update, and one more for every
+//					version published since
+uint64_t LiveGraph::version() const {
+	return versionNumber.load();
+}
+
+
+//------------------------------  applyUpdates  ----------------------------------
+//	Applies a batch of edge changes as one new version
+//	Preconditions:	none
+//	Postconditions:	a copy of the current version is made, sharing its edges, and
+//					every update is applied to it in order. once its compressed
+//					adjacency is built it is published as the current version. the
+//					number of updates that changed the graph is returned. readers
+//					that took the old version keep it. an empty batch publishes
+//					nothing
+int LiveGraph::applyUpdates(const vector<EdgeUpdate>& updates) {
+	if (updates.empty()) {
+		return 0;
+	}
+	lock_guard<mutex> guard(writeLock);
+
+	// the copy shares the compressed adjacency of the current version, and only
+	// builds adjacency lists of its own at the first change
+	shared_ptr<Graph> next = make_shared<Graph>(*atomic_load(&current));
+	int applied = 0;
+	for (const EdgeUpdate& update : updates) {
+		bool changed = update.removal ? next->removeEdge(update.source, update.destination)
+			: next->insertEdge(update.source, update.destination, update.weight);
+		if (changed) {
+			applied++;
+		}
+	}
+	install(next);
+	return applied;
+}
+
+
+//---------------------------------  publish  ------------------------------------
+//	Replaces the current version with a whole new graph
+//	Preconditions:	none
+//	Postconditions:	graph is moved into a new version, with its compressed
+//					adjacency up to date, and published as the current version.
+//					graph is left empty
+void LiveGraph::publish(Graph&& graph) {
+	lock_guard<mutex> guard(writeLock);
+	shared_ptr<Graph> next = make_shared<Graph>(move(graph));
+	next->setSharedTopology(true);
+	install(next);
+}
+
+
+//-------------------------------  install  --------------------------------------
+//	Publishes a built version
+//	Preconditions:	writeLock is held. nothing else holds next
+//	Postconditions:	the compressed adjacency of next is built, next is the current
+//					version and versionNumber counts it
+void LiveGraph::install(shared_ptr<Graph> next) {
+	// built before it is published, so no reader ever rebuilds it under a lock
+	next->freeze();
+	atomic_store(&current, shared_ptr<const Graph>(move(next)));
+	versionNumber++;
+}
@@ -0,0 +1,113 @@
+//---------------------------------------------------------------------------------
+// LiveGraph.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// LiveGraph Class:	Holds the current version of a Graph that changes while
+//					queries run on it. Readers take the version that is current
+//					and query it with the const Graph queries; writers build the
+//					next version beside it and swap it in, so a query never waits
+//					for an update and never sees one half done.
+//
+//   --	allows taking the current version, which stays valid and unchanged for
+//		as long as the reader holds on to it
+//   --	allows applying a batch of edge insertions and removals as one new
+//		version, built on a copy that shares the edges of the current one
+//   --	allows replacing the current version with a whole new graph
+//   --	frees an old version once the last reader that took it lets go of it
+//
+// Assumptions:
+//   -- versions are only changed through this class, never through a Graph a
+//		reader holds
+//   -- one writer builds a version at a time, others wait for it. readers never
+//		wait for a writer
+//   -- the version a reader took is freed on whichever thread lets go of it last
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "Graph.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+class LiveGraph {
+public:
+	// one change in a batch of updates
+	struct EdgeUpdate {
+		bool removal;			// true to remove the edge, false to insert it
+		int source;				// subscript of the source vertex
+		int destination;		// subscript of the destination vertex
+		int weight;				// weight of an inserted edge, unused for a removal
+	};
+
+
+	//-------------------------------  constructor  ----------------------------------
+	//	Constructor for the LiveGraph class
+	//	Preconditions:	none
+	//	Postconditions:	graph is moved into version 1, with its compressed adjacency
+	//					up to date and shared by the versions built from it. graph is
+	//					left empty
+	explicit LiveGraph(Graph&& graph);
+
+
+	//--------------------------------  snapshot  ------------------------------------
+	//	Returns the current version of the graph
+	//	Preconditions:	none
+	//	Postconditions:	the version that is current is returned. it is not changed by
+	//					later updates, and is kept alive while the caller holds it.
+	//					never waits for a writer
+	shared_ptr<const Graph> snapshot() const;
+
+
+	//---------------------------------  version  ------------------------------------
+	//	Returns the number of the current version
+	//	Preconditions:	none
+	//	Postconditions:	1 is returned before any update, and one more for every
+	//					version published since
+	uint64_t version() const;
+
+
+	//------------------------------  applyUpdates  ----------------------------------
+	//	Applies a batch of edge changes as one new version
+	//	Preconditions:	none
+	//	Postconditions:	a copy of the current version is made, sharing its edges, and
+	//					every update is applied to it in order. once its compressed
+	//					adjacency is built it is published as the current version. the
+	//					number of updates that changed the graph is returned. readers
+	//					that took the old version keep it. an empty batch publishes
+	//					nothing
+	int applyUpdates(const vector<EdgeUpdate>& updates);
+
+
+	//---------------------------------  publish  ------------------------------------
+	//	Replaces the current version with a whole new graph
+	//	Preconditions:	none
+	//	Postconditions:	graph is moved into a new version, with its compressed
+	//					adjacency up to date, and published as the current version.
+	//					graph is left empty
+	void publish(Graph&& graph);
+
+private:
+	shared_ptr<const Graph> current;	// read and replaced only with atomic_load and atomic_store
+	atomic<uint64_t> versionNumber;		// number of the version in current
+	mutex writeLock;					// held by the writer building the next version
+
+
+	//-------------------------------  install  --------------------------------------
+	//	Publishes a built version
+	//	Preconditions:	writeLock is held. nothing else holds next
+	//	Postconditions:	the compressed adjacency of next is built, next is the current
+	//					version and versionNumber counts it
+	void install(shared_ptr<Graph> next);
+
+
+	// not copyable, readers hold on to the versions of one object
+	LiveGraph(const LiveGraph&) = delete;
+	LiveGraph& operator=(const LiveGraph&) = delete;
+};
@@ -0,0 +1,195 @@
+//---------------------------------------------------------------------------------
+// MappedFile.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// MappedFile Class:	Maps a whole file into memory, read only, so its contents
+//						can be used in place without reading or copying them.
+//
+//   --	allows opening a file and mapping it into memory
+//   --	allows creating a file of a given length and mapping it read and write,
+//		so data larger than memory can be written to it in place
+//   --	allows reading the mapped bytes and their length
+//   --	unmaps the file when the object is destroyed
+//
+// Assumptions:
+//   -- the file is not changed by anyone while it is mapped
+//   -- uses the Windows file mapping functions when _WIN32 is defined, and
+//		mmap everywhere else
+//   -- the object cannot be copied, share it through a shared_ptr instead
+//---------------------------------------------------------------------------------
+
+
+
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the MappedFile class
+//	Preconditions:	none
+//	Postconditions:	an object with no file mapped is created
+MappedFile::MappedFile() {
+	bytes = nullptr;
+	byteCount = 0;
+	fileHandle = nullptr;
+	mappingHandle = nullptr;
+}
+
+
+//-------------------------------  destructor  -----------------------------------
+//	Destructor for the MappedFile class
+//	Preconditions:	none
+//	Postconditions:	the file is unmapped if one is mapped
+MappedFile::~MappedFile() {
+	close();
+}
+
+
+//----------------------------------  open  --------------------------------------
+//	Maps a file into memory, read only
+//	Preconditions:	no file is mapped by this object yet
+//	Postconditions:	true is returned if the file was opened and mapped, otherwise
+//					false is returned and no file is mapped
+bool MappedFile::open(const string& fileName) {
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	fileHandle = file;
+
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+		close();
+		return false;
+	}
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (mapping == nullptr) {
+		close();
+		return false;
+	}
+	mappingHandle = mapping;
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr) {
+		close();
+		return false;
+	}
+	bytes = static_cast<const char*>(view);
+	byteCount = static_cast<size_t>(fileSize.QuadPart);
+#else
+	int file = ::open(fileName.c_str(), O_RDONLY);
+	if (file < 0) {
+		return false;
+	}
+	struct stat status;
+	if (fstat(file, &status) != 0 || status.st_size == 0) {
+		::close(file);
+		return false;
+	}
+	void* view = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+	// the mapping stays valid after the descriptor is closed
+	::close(file);
+	if (view == MAP_FAILED) {
+		return false;
+	}
+	bytes = static_cast<const char*>(view);
+	byteCount = static_cast<size_t>(status.st_size);
+#endif
+	return true;
+}
+
+
+//---------------------------------  create  -------------------------------------
+//	Creates a file of a given length and maps it into memory, read and write
+//	Preconditions:	no file is mapped by this object yet. length is greater than 0
+//	Postconditions:	true is returned if fileName was created, or emptied if it was
+//					there, grown to length bytes of zeros and mapped. writes to the
+//					mapped bytes reach the file. otherwise false is returned and no
+//					file is mapped
+bool MappedFile::create(const string& fileName, size_t length) {
+	if (length == 0) {
+		return false;
+	}
+#ifdef _WIN32
+	HANDLE file = CreateFileA(fileName.c_str(), GENERIC_READ | GENERIC_WRITE, 0, nullptr,
+		CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		return false;
+	}
+	fileHandle = file;
+
+	// the mapping grows the file to its length
+	unsigned long long fileSize = length;
+	HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE,
+		static_cast<DWORD>(fileSize >> 32), static_cast<DWORD>(fileSize & 0xFFFFFFFF), nullptr);
+	if (mapping == nullptr) {
+		close();
+		return false;
+	}
+	mappingHandle = mapping;
+
+	void* view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0);
+	if (view == nullptr) {
+		close();
+		return false;
+	}
+	bytes = static_cast<const char*>(view);
+	byteCount = length;
+#else
+	int file = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (file < 0) {
+		return false;
+	}
+	if (ftruncate(file, static_cast<off_t>(length)) != 0) {
+		::close(file);
+		return false;
+	}
+	void* view = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+	// the mapping stays valid after the descriptor is closed
+	::close(file);
+	if (view == MAP_FAILED) {
+		return false;
+	}
+	bytes = static_cast<const char*>(view);
+	byteCount = length;
+#endif
+	return true;
+}
+
+
+//-------------------------------  close  ----------------------------------------
+//	Unmaps the file and closes any handles
+//	Preconditions:	none
+//	Postconditions:	no file is mapped
+void MappedFile::close() {
+#ifdef _WIN32
+	if (bytes != nullptr) {
+		UnmapViewOfFile(bytes);
+	}
+	if (mappingHandle != nullptr) {
+		CloseHandle(mappingHandle);
+	}
+	if (fileHandle != nullptr) {
+		CloseHandle(fileHandle);
+	}
+#else
+	if (bytes != nullptr) {
+		munmap(const_cast<char*>(bytes), byteCount);
+	}
+#endif
+	bytes = nullptr;
+	byteCount = 0;
+	fileHandle = nullptr;
+	mappingHandle = nullptr;
+}
@@ -0,0 +1,102 @@
+//---------------------------------------------------------------------------------
+// MappedFile.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// MappedFile Class:	Maps a whole file into memory, read only, so its contents
+//						can be used in place without reading or copying them.
+//
+//   --	allows opening a file and mapping it into memory
+//   --	allows creating a file of a given length and mapping it read and write,
+//		so data larger than memory can be written to it in place
+//   --	allows reading the mapped bytes and their length
+//   --	unmaps the file when the object is destroyed
+//
+// Assumptions:
+//   -- the file is not changed by anyone while it is mapped
+//   -- uses the Windows file mapping functions when _WIN32 is defined, and
+//		mmap everywhere else
+//   -- the object cannot be copied, share it through a shared_ptr instead
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include <cstddef>
+#include <string>
+
+using namespace std;
+
+class MappedFile {
+public:
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the MappedFile class
+	//	Preconditions:	none
+	//	Postconditions:	an object with no file mapped is created
+	MappedFile();
+
+
+	//-------------------------------  destructor  -----------------------------------
+	//	Destructor for the MappedFile class
+	//	Preconditions:	none
+	//	Postconditions:	the file is unmapped if one is mapped
+	~MappedFile();
+
+
+	//----------------------------------  open  --------------------------------------
+	//	Maps a file into memory, read only
+	//	Preconditions:	no file is mapped by this object yet
+	//	Postconditions:	true is returned if the file was opened and mapped, otherwise
+	//					false is returned and no file is mapped
+	bool open(const string& fileName);
+
+
+	//---------------------------------  create  -------------------------------------
+	//	Creates a file of a given length and maps it into memory, read and write
+	//	Preconditions:	no file is mapped by this object yet. length is greater than 0
+	//	Postconditions:	true is returned if fileName was created, or emptied if it was
+	//					there, grown to length bytes of zeros and mapped. writes to the
+	//					mapped bytes reach the file. otherwise false is returned and no
+	//					file is mapped
+	bool create(const string& fileName, size_t length);
+
+
+	//----------------------------------  data  --------------------------------------
+	//	Returns the first mapped byte
+	//	Preconditions:	open returned true
+	//	Postconditions:	a pointer to the mapped bytes is returned
+	const char* data() const { return bytes; }
+
+
+	//------------------------------  writableData  ----------------------------------
+	//	Returns the first mapped byte of a file mapped by create
+	//	Preconditions:	create returned true
+	//	Postconditions:	a pointer to the mapped bytes that can be written through is
+	//					returned
+	char* writableData() const { return const_cast<char*>(bytes); }
+
+
+	//---------------------------------  length  -------------------------------------
+	//	Returns the number of mapped bytes
+	//	Preconditions:	none
+	//	Postconditions:	the length of the file, or 0 if no file is mapped
+	size_t length() const { return byteCount; }
+
+private:
+	const char* bytes;			// first mapped byte, nullptr if nothing is mapped
+	size_t byteCount;			// number of mapped bytes
+	void* fileHandle;			// Windows file and mapping handles, unused for mmap
+	void* mappingHandle;
+
+
+	//-------------------------------  close  ----------------------------------------
+	//	Unmaps the file and closes any handles
+	//	Preconditions:	none
+	//	Postconditions:	no file is mapped
+	void close();
+
+
+	// not copyable, the mapping belongs to one object
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+};
@@ -0,0 +1,193 @@
+//---------------------------------------------------------------------------------
+// MinScan.cpp
+// Author: Brent Barrese
+// Function Definitions
+//---------------------------------------------------------------------------------
+// findMinimum:	Finds the lowest key in an array of distances with vector
+//				instructions, comparing a whole register of keys at a time
+//				instead of branching on each one. Used by the Graph class to pick
+//				the next vertex of Dijkstra's Algorithm on dense graphs.
+//
+//   --	uses AVX-512 when __AVX512F__ is defined, AVX2 when __AVX2__ is defined,
+//		SSE2 for 32 bit distances on any x86 compiler that has it, and a plain
+//		loop everywhere else
+//   --	a key of NO_DISTANCE is never picked, so visited vertices are masked out
+//		by setting their key to NO_DISTANCE
+//
+// Assumptions:
+//   -- the instruction set is chosen when the program is compiled, so the
+//		program only runs on processors that have the instructions it was
+//		compiled for
+//   -- ties between equal keys are broken by the lower subscript, the same way
+//		a linear scan of the table row breaks them
+//---------------------------------------------------------------------------------
+
+
+
+#include "MinScan.h"
+
+#if defined(__AVX512F__)
+#define MIN_SCAN_AVX512
+#elif defined(__AVX2__)
+#define MIN_SCAN_AVX2
+#elif !defined(DIJKSTRA_WIDE_DISTANCE) && (defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MIN_SCAN_SSE2
+#endif
+
+#if defined(MIN_SCAN_AVX512) || defined(MIN_SCAN_AVX2) || defined(MIN_SCAN_SSE2)
+#include <immintrin.h>
+#endif
+
+
+//-------------------------------  reduceLanes  ------------------------------------
+//	Folds the lowest key and subscript kept by each vector lane into one answer
+//	Preconditions:	values and indices hold lanes entries. a lane that never found
+//					a key below NO_DISTANCE holds NO_DISTANCE
+//	Postconditions:	best and bestIndex hold the lowest key and its lowest subscript
+//					among best, bestIndex and the lanes
+template <class Index>
+static void reduceLanes(const Distance* values, const Index* indices, int lanes,
+	Distance& best, int& bestIndex) {
+	for (int lane = 0; lane < lanes; lane++) {
+		int index = static_cast<int>(indices[lane]);
+		if (values[lane] < best || (values[lane] == best && values[lane] != NO_DISTANCE &&
+			index < bestIndex)) {
+			best = values[lane];
+			bestIndex = index;
+		}
+	}
+}
+
+
+//--------------------------------  findMinimum  -----------------------------------
+//	Finds the subscript of the lowest key
+//	Preconditions:	keys holds count keys. count is greater than or equal to 0
+//	Postconditions:	the lowest subscript whose key is the lowest key is returned.
+//					-1 is returned if every key is NO_DISTANCE, or count is 0
+int findMinimum(const Distance* keys, int count) {
+	Distance best = NO_DISTANCE;
+	int bestIndex = -1;
+	int i = 0;
+
+	// each lane keeps the first lowest key it has seen and where it was, by only
+	// taking a key that is strictly lower
+#if defined(MIN_SCAN_AVX512) && !defined(DIJKSTRA_WIDE_DISTANCE)
+	const int LANES = 16;
+	__m512i laneBest = _mm512_set1_epi32(NO_DISTANCE);
+	__m512i laneIndex = _mm512_set1_epi32(-1);
+	__m512i index = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+	const __m512i step = _mm512_set1_epi32(LANES);
+	for (; i + LANES <= count; i += LANES) {
+		__m512i key = _mm512_loadu_si512(keys + i);
+		__mmask16 lower = _mm512_cmplt_epi32_mask(key, laneBest);
+		laneBest = _mm512_mask_mov_epi32(laneBest, lower, key);
+		laneIndex = _mm512_mask_mov_epi32(laneIndex, lower, index);
+		index = _mm512_add_epi32(index, step);
+	}
+	alignas(64) Distance values[LANES];
+	alignas(64) int32_t indices[LANES];
+	_mm512_store_si512(values, laneBest);
+	_mm512_store_si512(indices, laneIndex);
+	reduceLanes(values, indices, LANES, best, bestIndex);
+#elif defined(MIN_SCAN_AVX512)
+	const int LANES = 8;
+	__m512i laneBest = _mm512_set1_epi64(NO_DISTANCE);
+	__m512i laneIndex = _mm512_set1_epi64(-1);
+	__m512i index = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+	const __m512i step = _mm512_set1_epi64(LANES);
+	for (; i + LANES <= count; i += LANES) {
+		__m512i key = _mm512_loadu_si512(keys + i);
+		__mmask8 lower = _mm512_cmplt_epi64_mask(key, laneBest);
+		laneBest = _mm512_mask_mov_epi64(laneBest, lower, key);
+		laneIndex = _mm512_mask_mov_epi64(laneIndex, lower, index);
+		index = _mm512_add_epi64(index, step);
+	}
+	alignas(64) Distance values[LANES];
+	alignas(64) int64_t indices[LANES];
+	_mm512_store_si512(values, laneBest);
+	_mm512_store_si512(indices, laneIndex);
+	reduceLanes(values, indices, LANES, best, bestIndex);
+#elif defined(MIN_SCAN_AVX2) && !defined(DIJKSTRA_WIDE_DISTANCE)
+	const int LANES = 8;
+	__m256i laneBest = _mm256_set1_epi32(NO_DISTANCE);
+	__m256i laneIndex = _mm256_set1_epi32(-1);
+	__m256i index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	const __m256i step = _mm256_set1_epi32(LANES);
+	for (; i + LANES <= count; i += LANES) {
+		__m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+		__m256i lower = _mm256_cmpgt_epi32(laneBest, key);
+		laneBest = _mm256_blendv_epi8(laneBest, key, lower);
+		laneIndex = _mm256_blendv_epi8(laneIndex, index, lower);
+		index = _mm256_add_epi32(index, step);
+	}
+	alignas(32) Distance values[LANES];
+	alignas(32) int32_t indices[LANES];
+	_mm256_store_si256(reinterpret_cast<__m256i*>(values), laneBest);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(indices), laneIndex);
+	reduceLanes(values, indices, LANES, best, bestIndex);
+#elif defined(MIN_SCAN_AVX2)
+	const int LANES = 4;
+	__m256i laneBest = _mm256_set1_epi64x(NO_DISTANCE);
+	__m256i laneIndex = _mm256_set1_epi64x(-1);
+	__m256i index = _mm256_setr_epi64x(0, 1, 2, 3);
+	const __m256i step = _mm256_set1_epi64x(LANES);
+	for (; i + LANES <= count; i += LANES) {
+		__m256i key = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+		__m256i lower = _mm256_cmpgt_epi64(laneBest, key);
+		laneBest = _mm256_blendv_epi8(laneBest, key, lower);
+		laneIndex = _mm256_blendv_epi8(laneIndex, index, lower);
+		index = _mm256_add_epi64(index, step);
+	}
+	alignas(32) Distance values[LANES];
+	alignas(32) int64_t indices[LANES];
+	_mm256_store_si256(reinterpret_cast<__m256i*>(values), laneBest);
+	_mm256_store_si256(reinterpret_cast<__m256i*>(indices), laneIndex);
+	reduceLanes(values, indices, LANES, best, bestIndex);
+#elif defined(MIN_SCAN_SSE2)
+	// SSE2 has no blend, so the lanes are picked with and, andnot and or
+	const int LANES = 4;
+	__m128i laneBest = _mm_set1_epi32(NO_DISTANCE);
+	__m128i laneIndex = _mm_set1_epi32(-1);
+	__m128i index = _mm_setr_epi32(0, 1, 2, 3);
+	const __m128i step = _mm_set1_epi32(LANES);
+	for (; i + LANES <= count; i += LANES) {
+		__m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+		__m128i lower = _mm_cmplt_epi32(key, laneBest);
+		laneBest = _mm_or_si128(_mm_and_si128(lower, key), _mm_andnot_si128(lower, laneBest));
+		laneIndex = _mm_or_si128(_mm_and_si128(lower, index), _mm_andnot_si128(lower, laneIndex));
+		index = _mm_add_epi32(index, step);
+	}
+	alignas(16) Distance values[LANES];
+	alignas(16) int32_t indices[LANES];
+	_mm_store_si128(reinterpret_cast<__m128i*>(values), laneBest);
+	_mm_store_si128(reinterpret_cast<__m128i*>(indices), laneIndex);
+	reduceLanes(values, indices, LANES, best, bestIndex);
+#endif
+
+	// the keys left over after the last full register, all past the lanes' keys
+	for (; i < count; i++) {
+		if (keys[i] < best) {
+			best = keys[i];
+			bestIndex = i;
+		}
+	}
+	return best == NO_DISTANCE ? -1 : bestIndex;
+}
+
+
+//------------------------------  minScanKernel  -----------------------------------
+//	Names the instruction set findMinimum was compiled for
+//	Preconditions:	none
+//	Postconditions:	"AVX-512", "AVX2", "SSE2" or "scalar" is returned
+const char* minScanKernel() {
+#if defined(MIN_SCAN_AVX512)
+	return "AVX-512";
+#elif defined(MIN_SCAN_AVX2)
+	return "AVX2";
+#elif defined(MIN_SCAN_SSE2)
+	return "SSE2";
+#else
+	return "scalar";
+#endif
+}
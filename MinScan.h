@@ -0,0 +1,42 @@
+//---------------------------------------------------------------------------------
+// MinScan.h
+// Author: Brent Barrese
+// Function Declarations
+//---------------------------------------------------------------------------------
+// findMinimum:	Finds the lowest key in an array of distances with vector
+//				instructions, comparing a whole register of keys at a time
+//				instead of branching on each one. Used by the Graph class to pick
+//				the next vertex of Dijkstra's Algorithm on dense graphs.
+//
+//   --	uses AVX-512 when __AVX512F__ is defined, AVX2 when __AVX2__ is defined,
+//		SSE2 for 32 bit distances on any x86 compiler that has it, and a plain
+//		loop everywhere else
+//   --	a key of NO_DISTANCE is never picked, so visited vertices are masked out
+//		by setting their key to NO_DISTANCE
+//
+// Assumptions:
+//   -- the instruction set is chosen when the program is compiled, so the
+//		program only runs on processors that have the instructions it was
+//		compiled for
+//   -- ties between equal keys are broken by the lower subscript, the same way
+//		a linear scan of the table row breaks them
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "Distance.h"
+
+//--------------------------------  findMinimum  -----------------------------------
+//	Finds the subscript of the lowest key
+//	Preconditions:	keys holds count keys. count is greater than or equal to 0
+//	Postconditions:	the lowest subscript whose key is the lowest key is returned.
+//					-1 is returned if every key is NO_DISTANCE, or count is 0
+int findMinimum(const Distance* keys, int count);
+
+
+//------------------------------  minScanKernel  -----------------------------------
+//	Names the instruction set findMinimum was compiled for
+//	Preconditions:	none
+//	Postconditions:	"AVX-512", "AVX2", "SSE2" or "scalar" is returned
+const char* minScanKernel();
@@ -0,0 +1,272 @@
+//---------------------------------------------------------------------------------
+// NodePool.h
+// Author: Brent Barrese
+// Class Declarations and Definitions
+//---------------------------------------------------------------------------------
+// NodePool Class:	A block allocator for many small objects of one type. Objects
+//					are carved out of large blocks by bumping a pointer, objects
+//					that are destroyed are kept on a free list for reuse, and all of
+//					the blocks are released together in one go.
+//
+//   --	allows creating a default constructed object
+//   --	allows destroying one object so its slot can be reused
+//   --	allows reserving room for a known number of objects up front
+//   --	allows releasing every block at once
+//
+// Assumptions:
+//   -- the type does not need more alignment than the default operator new gives
+//   -- objects whose type has a destructor are destroyed before releaseAll runs,
+//		releaseAll only frees the memory
+//   -- a pool is owned by one object and cannot be copied, but it can be moved
+//   -- being a template, the definitions are in this header
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include <new>
+#include <vector>
+
+using namespace std;
+
+template <class T>
+class NodePool {
+public:
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the NodePool class
+	//	Preconditions:	none
+	//	Postconditions:	an empty pool that owns no blocks is created
+	NodePool();
+
+
+	//-------------------------------  destructor  -----------------------------------
+	//	Destructor for the NodePool class
+	//	Preconditions:	none
+	//	Postconditions:	every block is released
+	~NodePool();
+
+
+	//----------------------------  move constructor  --------------------------------
+	//	Move constructor for the NodePool class
+	//	Preconditions:	none
+	//	Postconditions:	this pool owns the blocks of fromPool, which is left empty
+	NodePool(NodePool&& fromPool);
+
+
+	//--------------------------  move assignment operator  --------------------------
+	//	Move assignment operator for the NodePool class
+	//	Preconditions:	none
+	//	Postconditions:	the blocks of this pool are released. this pool owns the
+	//					blocks of fromPool, which is left empty
+	NodePool& operator=(NodePool&& fromPool);
+
+
+	//----------------------------------  create  ------------------------------------
+	//	Creates a default constructed object in the pool
+	//	Preconditions:	none
+	//	Postconditions:	a pointer to the new object is returned. a free slot is reused
+	//					if there is one, otherwise the next slot of the current block
+	//					is used, starting a new block when it is full
+	T* create();
+
+
+	//---------------------------------  destroy  ------------------------------------
+	//	Destroys an object that was created by this pool
+	//	Preconditions:	node was returned by create on this pool and is not destroyed
+	//	Postconditions:	the destructor of node is ran and its slot is kept for reuse
+	void destroy(T* node);
+
+
+	//---------------------------------  reserve  ------------------------------------
+	//	Makes sure the next count objects can be created without a new block
+	//	Preconditions:	count is greater than or equal to 0
+	//	Postconditions:	the current block has room for at least count more objects
+	void reserve(int count);
+
+
+	//-------------------------------  releaseAll  -----------------------------------
+	//	Releases every block the pool owns
+	//	Preconditions:	objects whose type has a destructor have been destroyed
+	//	Postconditions:	the pool is empty and every object it created is gone
+	void releaseAll();
+
+private:
+	// a slot holds either a live object or a link in the free list
+	union Slot {
+		Slot* next;
+		alignas(T) unsigned char storage[sizeof(T)];
+	};
+
+	static const int FIRST_BLOCK = 64;			// slots in the first block
+	static const int LARGEST_BLOCK = 65536;		// blocks stop doubling at this size
+
+	vector<Slot*> blocks;		// every block the pool has allocated
+	Slot* current;				// block that new slots are bumped out of
+	int used;					// slots of current handed out so far
+	int capacity;				// slots in current
+	Slot* freeList;				// slots of destroyed objects
+	int nextBlock;				// slots in the next block that is allocated
+
+
+	//--------------------------------  addBlock  ------------------------------------
+	//	Allocates a new block and makes it the current block
+	//	Preconditions:	slots is greater than 0
+	//	Postconditions:	current is a new, unused block of slots slots
+	void addBlock(int slots);
+
+
+	// not copyable, the blocks belong to one pool
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+};
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the NodePool class
+//	Preconditions:	none
+//	Postconditions:	an empty pool that owns no blocks is created
+template <class T>
+NodePool<T>::NodePool() {
+	current = nullptr;
+	used = 0;
+	capacity = 0;
+	freeList = nullptr;
+	nextBlock = FIRST_BLOCK;
+}
+
+
+//-------------------------------  destructor  -----------------------------------
+//	Destructor for the NodePool class
+//	Preconditions:	none
+//	Postconditions:	every block is released
+template <class T>
+NodePool<T>::~NodePool() {
+	releaseAll();
+}
+
+
+//----------------------------  move constructor  --------------------------------
+//	Move constructor for the NodePool class
+//	Preconditions:	none
+//	Postconditions:	this pool owns the blocks of fromPool, which is left empty
+template <class T>
+NodePool<T>::NodePool(NodePool&& fromPool) : NodePool() {
+	*this = static_cast<NodePool&&>(fromPool);
+}
+
+
+//--------------------------  move assignment operator  --------------------------
+//	Move assignment operator for the NodePool class
+//	Preconditions:	none
+//	Postconditions:	the blocks of this pool are released. this pool owns the
+//					blocks of fromPool, which is left empty
+template <class T>
+NodePool<T>& NodePool<T>::operator=(NodePool&& fromPool) {
+	if (this != &fromPool) {
+		releaseAll();
+		blocks.swap(fromPool.blocks);
+		current = fromPool.current;
+		used = fromPool.used;
+		capacity = fromPool.capacity;
+		freeList = fromPool.freeList;
+		nextBlock = fromPool.nextBlock;
+
+		fromPool.current = nullptr;
+		fromPool.used = 0;
+		fromPool.capacity = 0;
+		fromPool.freeList = nullptr;
+		fromPool.nextBlock = FIRST_BLOCK;
+	}
+	return *this;
+}
+
+
+//----------------------------------  create  ------------------------------------
+//	Creates a default constructed object in the pool
+//	Preconditions:	none
+//	Postconditions:	a pointer to the new object is returned. a free slot is reused
+//					if there is one, otherwise the next slot of the current block
+//					is used, starting a new block when it is full
+template <class T>
+T* NodePool<T>::create() {
+	Slot* slot;
+	if (freeList != nullptr) {
+		slot = freeList;
+		freeList = freeList->next;
+	}
+	else {
+		if (used == capacity) {
+			addBlock(nextBlock);
+		}
+		slot = current + used;
+		used++;
+	}
+	return new (slot->storage) T();
+}
+
+
+//---------------------------------  destroy  ------------------------------------
+//	Destroys an object that was created by this pool
+//	Preconditions:	node was returned by create on this pool and is not destroyed
+//	Postconditions:	the destructor of node is ran and its slot is kept for reuse
+template <class T>
+void NodePool<T>::destroy(T* node) {
+	node->~T();
+	Slot* slot = reinterpret_cast<Slot*>(node);
+	slot->next = freeList;
+	freeList = slot;
+}
+
+
+//---------------------------------  reserve  ------------------------------------
+//	Makes sure the next count objects can be created without a new block
+//	Preconditions:	count is greater than or equal to 0
+//	Postconditions:	the current block has room for at least count more objects
+template <class T>
+void NodePool<T>::reserve(int count) {
+	if (capacity - used < count) {
+		addBlock(count > nextBlock ? count : nextBlock);
+	}
+}
+
+
+//-------------------------------  releaseAll  -----------------------------------
+//	Releases every block the pool owns
+//	Preconditions:	objects whose type has a destructor have been destroyed
+//	Postconditions:	the pool is empty and every object it created is gone
+template <class T>
+void NodePool<T>::releaseAll() {
+	for (Slot* block : blocks) {
+		::operator delete(block);
+	}
+	blocks.clear();
+	current = nullptr;
+	used = 0;
+	capacity = 0;
+	freeList = nullptr;
+	nextBlock = FIRST_BLOCK;
+}
+
+
+//--------------------------------  addBlock  ------------------------------------
+//	Allocates a new block and makes it the current block
+//	Preconditions:	slots is greater than 0
+//	Postconditions:	current is a new, unused block of slots slots
+template <class T>
+void NodePool<T>::addBlock(int slots) {
+	// the unused end of the old block is put on the free list so it is not lost
+	while (used < capacity) {
+		current[used].next = freeList;
+		freeList = current + used;
+		used++;
+	}
+
+	blocks.push_back(nullptr);
+	current = static_cast<Slot*>(::operator new(sizeof(Slot) * slots));
+	blocks.back() = current;
+	used = 0;
+	capacity = slots;
+	if (nextBlock < LARGEST_BLOCK) {
+		nextBlock *= 2;
+	}
+}
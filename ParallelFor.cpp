@@ -0,0 +1,211 @@
+//---------------------------------------------------------------------------------
+// ParallelFor.cpp
+// Author: Brent Barrese
+// Function Definitions
+//---------------------------------------------------------------------------------
+// parallelFor:	Runs a loop body for every index in a range on a pool of worker
+//				threads. Workers take the next index from a shared counter, so a
+//				thread that finishes a cheap index goes on to the next one instead
+//				of waiting on a fixed share of the range.
+//
+//   --	keeps the worker threads for the life of the program. they are started
+//		the first time a loop needs them and wait for the next loop in between,
+//		so a loop costs a wake up instead of starting and joining threads
+//   --	the calling thread is always one of the workers of its loop, so a loop
+//		finishes even when every pooled thread is busy, and a body may run a
+//		loop of its own
+//   --	allows several threads to run loops at once, the pooled threads help
+//		whichever loops are waiting
+//
+// Assumptions:
+//   -- the body may be called for different indices at the same time, so it
+//		only writes state that belongs to its own index
+//   -- a thread count of 0 means one worker per hardware thread
+//   -- the pooled threads are stopped and joined when the program ends, no loop
+//		is running then
+//---------------------------------------------------------------------------------
+
+
+
+#include "ParallelFor.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// one call of parallelFor. it lives on the stack of the calling thread, which
+// does not return until no pooled thread is running it
+struct ParallelLoop {
+	const function<void(int)>* body;
+	atomic<int> next;			// next index to be taken
+	int last;					// one past the last index
+	int openSlots;				// pooled threads that may still join, under the pool lock
+	int helpers;				// pooled threads running the loop now, under the pool lock
+	exception_ptr failure;		// first exception thrown by body
+	mutex failureLock;
+
+	// takes indices until the range runs out
+	void work() {
+		for (int i = next++; i < last; i = next++) {
+			try {
+				(*body)(i);
+			}
+			catch (...) {
+				lock_guard<mutex> guard(failureLock);
+				if (failure == nullptr) {
+					failure = current_exception();
+				}
+				next = last;
+			}
+		}
+	}
+};
+
+
+// the worker threads every parallelFor shares
+class WorkerPool {
+public:
+	//-------------------------------  destructor  -----------------------------------
+	//	Stops the worker threads
+	//	Preconditions:	no loop is running
+	//	Postconditions:	every worker thread has been joined
+	~WorkerPool() {
+		{
+			lock_guard<mutex> guard(lock);
+			stopping = true;
+		}
+		wake.notify_all();
+		for (thread& worker : workers) {
+			worker.join();
+		}
+	}
+
+
+	//----------------------------------  run  ---------------------------------------
+	//	Runs a loop on the calling thread and up to helperCount pooled threads
+	//	Preconditions:	helperCount is greater than 0
+	//	Postconditions:	every index of loop has been taken, and no pooled thread is
+	//					running loop any longer
+	void run(ParallelLoop& loop, int helperCount) {
+		{
+			lock_guard<mutex> guard(lock);
+			while (static_cast<int>(workers.size()) < helperCount) {
+				workers.emplace_back(&WorkerPool::serve, this);
+			}
+			loop.openSlots = helperCount;
+			loop.helpers = 0;
+			waiting.push_back(&loop);
+		}
+		wake.notify_all();
+
+		loop.work();
+
+		// no pooled thread may join once the loop is off the list, then the ones
+		// that did are waited for
+		unique_lock<mutex> guard(lock);
+		for (auto it = waiting.begin(); it != waiting.end(); ++it) {
+			if (*it == &loop) {
+				waiting.erase(it);
+				break;
+			}
+		}
+		finished.wait(guard, [&loop]() { return loop.helpers == 0; });
+	}
+
+private:
+	mutex lock;
+	condition_variable wake;		// a loop is waiting, or the pool is stopping
+	condition_variable finished;	// a pooled thread has left a loop
+	deque<ParallelLoop*> waiting;		// loops that still have open slots
+	vector<thread> workers;
+	bool stopping = false;
+
+
+	//---------------------------------  serve  --------------------------------------
+	//	Body of each pooled thread
+	//	Preconditions:	none
+	//	Postconditions:	the thread has helped with loops until the pool stopped
+	void serve() {
+		unique_lock<mutex> guard(lock);
+		for (;;) {
+			wake.wait(guard, [this]() { return stopping || !waiting.empty(); });
+			if (stopping) {
+				return;
+			}
+			ParallelLoop* loop = waiting.front();
+			if (--loop->openSlots == 0) {
+				waiting.pop_front();
+			}
+			loop->helpers++;
+
+			guard.unlock();
+			loop->work();
+			guard.lock();
+
+			if (--loop->helpers == 0) {
+				finished.notify_all();
+			}
+		}
+	}
+};
+
+
+//-----------------------------------  pool  -------------------------------------
+//	Returns the pool every parallelFor shares
+//	Preconditions:	none
+//	Postconditions:	the pool is made the first time this is called
+static WorkerPool& pool() {
+	static WorkerPool workers;
+	return workers;
+}
+
+
+//--------------------------------  parallelFor  -----------------------------------
+//	Calls body(i) once for every i from first to last - 1
+//	Preconditions:	body is safe to call for different indices at the same time.
+//					threadCount is greater than or equal to 0
+//	Postconditions:	body has been called for every index once all the workers have
+//					finished. the calling thread and up to threadCount - 1 pooled
+//					threads take the indices. with one worker, or a range of one
+//					index, the calls are made in order on the calling thread. if
+//					body throws, the first exception is rethrown on the calling thread
+void parallelFor(int first, int last, int threadCount, const function<void(int)>& body) {
+	int workers = resolveThreadCount(threadCount);
+	if (last - first < workers) {
+		workers = last - first;
+	}
+	if (workers <= 1) {
+		for (int i = first; i < last; i++) {
+			body(i);
+		}
+		return;
+	}
+
+	ParallelLoop loop;
+	loop.body = &body;
+	loop.next = first;
+	loop.last = last;
+	loop.failure = nullptr;
+	pool().run(loop, workers - 1);
+
+	if (loop.failure != nullptr) {
+		rethrow_exception(loop.failure);
+	}
+}
+
+
+//----------------------------  resolveThreadCount  --------------------------------
+//	Turns a requested thread count into the number of workers to start
+//	Preconditions:	threadCount is greater than or equal to 0
+//	Postconditions:	threadCount is returned, or the number of hardware threads if
+//					threadCount is 0. at least 1 is returned
+int resolveThreadCount(int threadCount) {
+	if (threadCount <= 0) {
+		threadCount = static_cast<int>(thread::hardware_concurrency());
+	}
+	return threadCount > 0 ? threadCount : 1;
+}
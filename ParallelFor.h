@@ -0,0 +1,52 @@
+//---------------------------------------------------------------------------------
+// ParallelFor.h
+// Author: Brent Barrese
+// Function Declarations
+//---------------------------------------------------------------------------------
+// parallelFor:	Runs a loop body for every index in a range on a pool of worker
+//				threads. Workers take the next index from a shared counter, so a
+//				thread that finishes a cheap index goes on to the next one instead
+//				of waiting on a fixed share of the range.
+//
+//   --	keeps the worker threads for the life of the program. they are started
+//		the first time a loop needs them and wait for the next loop in between,
+//		so a loop costs a wake up instead of starting and joining threads
+//   --	the calling thread is always one of the workers of its loop, so a loop
+//		finishes even when every pooled thread is busy, and a body may run a
+//		loop of its own
+//   --	allows several threads to run loops at once, the pooled threads help
+//		whichever loops are waiting
+//
+// Assumptions:
+//   -- the body may be called for different indices at the same time, so it
+//		only writes state that belongs to its own index
+//   -- a thread count of 0 means one worker per hardware thread
+//   -- the pooled threads are stopped and joined when the program ends, no loop
+//		is running then
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include <functional>
+
+using namespace std;
+
+//--------------------------------  parallelFor  -----------------------------------
+//	Calls body(i) once for every i from first to last - 1
+//	Preconditions:	body is safe to call for different indices at the same time.
+//					threadCount is greater than or equal to 0
+//	Postconditions:	body has been called for every index once all the workers have
+//					finished. the calling thread and up to threadCount - 1 pooled
+//					threads take the indices. with one worker, or a range of one
+//					index, the calls are made in order on the calling thread. if
+//					body throws, the first exception is rethrown on the calling thread
+void parallelFor(int first, int last, int threadCount, const function<void(int)>& body);
+
+
+//----------------------------  resolveThreadCount  --------------------------------
+//	Turns a requested thread count into the number of workers to start
+//	Preconditions:	threadCount is greater than or equal to 0
+//	Postconditions:	threadCount is returned, or the number of hardware threads if
+//					threadCount is 0. at least 1 is returned
+int resolveThreadCount(int threadCount);
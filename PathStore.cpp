@@ -0,0 +1,317 @@
+//---------------------------------------------------------------------------------
+// PathStore.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// PathStore Class:	Holds the shortest distances, and optionally the previous
+//					vertices, from a chosen set of source vertices to every vertex,
+//					in cells only as wide as the graph needs. Used by the Graph
+//					class to keep all pairs results for graphs whose Table T would
+//					not fit in memory.
+//
+//   --	chooses the width of a distance cell, 1, 2, 4 or 8 bytes, from the
+//		longest distance a path can have, and the width of a previous vertex
+//		cell, 1, 2 or 4 bytes, from the number of vertices
+//   --	allows keeping only the distances, or the distances and the previous
+//		vertices that paths are read back from
+//   --	allows keeping the rows of only some source vertices
+//   --	keeps the cells in memory, or in a file mapped into memory so the
+//		operating system pages rows in and out of it as they are used
+//   --	allows reading the distance and the path between two vertices
+//
+// Assumptions:
+//   -- vertex subscripts are in the range 0 to vertexCount - 1
+//   -- the widest value of a distance cell stands for no path, so the longest
+//		distance is always below it
+//   -- a previous vertex of 0 stands for the source itself or no path
+//   -- the rows only hold for the edges they were computed on, the store is
+//		rebuilt when an edge changes
+//   -- a store file holds the distance rows, then the previous vertex rows, in
+//		the byte order of the machine that built it. it is scratch space and is
+//		not read back by a later run
+//---------------------------------------------------------------------------------
+
+
+
+#include "PathStore.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the PathStore class
+//	Preconditions:	none
+//	Postconditions:	an empty store with no rows and no vertices is created
+PathStore::PathStore() {
+	vertices = 0;
+	distanceWidth = 0;
+	previousWidth = 0;
+	noPath = 0;
+	distances = nullptr;
+	previous = nullptr;
+}
+
+
+//---------------------------------  reset  --------------------------------------
+//	Sizes the store for a graph and a list of source vertices
+//	Preconditions:	vertexCount is greater than 0. every source is in the range 1
+//					to vertexCount - 1 and listed once. maxDistance is the longest
+//					distance a shortest path can have
+//	Postconditions:	the cell widths are chosen and one row per source is made, in
+//					memory if fileName is empty, otherwise in fileName mapped into
+//					memory. true is returned, or false if the file could not be
+//					made, in which case the store is empty. every cell reads as no
+//					path until its row is set
+bool PathStore::reset(int vertexCount, const vector<int>& sources, uint64_t maxDistance,
+	Contents contents, const string& fileName) {
+	// one value past the longest distance is kept free for no path
+	distanceWidth = cellWidth(maxDistance + 1, 8);
+	noPath = distanceWidth == 8 ? UINT64_MAX : (uint64_t(1) << (8 * distanceWidth)) - 1;
+	previousWidth = contents == DISTANCES_AND_PATHS ? cellWidth(vertexCount, 4) : 0;
+	vertices = vertexCount;
+	this->sources = sources;
+	slotOf.assign(vertexCount, -1);
+	for (int slot = 0; slot < static_cast<int>(sources.size()); slot++) {
+		slotOf[sources[slot]] = slot;
+	}
+
+	uint64_t cells = static_cast<uint64_t>(vertexCount) * sources.size();
+	uint64_t distanceBytes = cells * distanceWidth;
+	uint64_t total = distanceBytes + cells * previousWidth;
+	char* storage = nullptr;
+	memory.clear();
+	memory.shrink_to_fit();
+	file.reset();
+	if (fileName.empty()) {
+		memory.assign(static_cast<size_t>(total), 0);
+		storage = memory.data();
+	}
+	else if (total > 0) {
+		file = make_shared<MappedFile>();
+		if (!file->create(fileName, static_cast<size_t>(total))) {
+			file.reset();
+			distanceWidth = 0;
+			previousWidth = 0;
+			vertices = 0;
+			this->sources.clear();
+			slotOf.clear();
+			distances = nullptr;
+			previous = nullptr;
+			return false;
+		}
+		storage = file->writableData();
+	}
+
+	distances = storage;
+	previous = previousWidth > 0 ? storage + distanceBytes : nullptr;
+	// no path is every bit set whatever the width, and a zero cell is distance 0
+	if (distanceBytes > 0) {
+		memset(distances, 0xFF, static_cast<size_t>(distanceBytes));
+	}
+	return true;
+}
+
+
+//---------------------------------  setRow  -------------------------------------
+//	Stores the shortest paths from one source
+//	Preconditions:	slot is in the range 0 to sourceCount() - 1. dist holds
+//					vertexCount() entries, and so does previous if the store keeps
+//					paths, otherwise previous is not read. dist[v] is the distance
+//					from the source of slot to v, NO_DISTANCE if there is no path,
+//					and previous[v] the vertex before v on that path
+//	Postconditions:	the row of slot is replaced. rows of different slots can be
+//					set at the same time
+void PathStore::setRow(int slot, const vector<Distance>& dist, const vector<int>& previous) {
+	uint64_t first = static_cast<uint64_t>(slot) * vertices;
+	for (int v = 0; v < vertices; v++) {
+		uint64_t value = dist[v] == NO_DISTANCE ? noPath : static_cast<uint64_t>(dist[v]);
+		writeCell(distances + (first + v) * distanceWidth, distanceWidth, value);
+	}
+	if (this->previous != nullptr) {
+		int source = sources[slot];
+		for (int v = 0; v < vertices; v++) {
+			int before = (v == source || dist[v] == NO_DISTANCE) ? 0 : previous[v];
+			writeCell(this->previous + (first + v) * previousWidth, previousWidth,
+				static_cast<uint64_t>(before));
+		}
+	}
+}
+
+
+//---------------------------------  hasRow  -------------------------------------
+//	Returns whether the store holds the row of a source vertex
+//	Preconditions:	none
+//	Postconditions:	true is returned if source is one of the sources the store
+//					was sized for. store is not changed
+bool PathStore::hasRow(int source) const {
+	return source >= 0 && source < vertices && slotOf[source] >= 0;
+}
+
+
+//--------------------------------  distance  ------------------------------------
+//	Returns the shortest distance from one vertex to another
+//	Preconditions:	hasRow(source) is true. destination is in the range 0 to
+//					vertexCount() - 1
+//	Postconditions:	the distance is returned, NO_DISTANCE if there is no path
+Distance PathStore::distance(int source, int destination) const {
+	uint64_t cell = static_cast<uint64_t>(slotOf[source]) * vertices + destination;
+	uint64_t value = readCell(distances + cell * distanceWidth, distanceWidth);
+	return value == noPath ? NO_DISTANCE : static_cast<Distance>(value);
+}
+
+
+//----------------------------------  path  --------------------------------------
+//	Returns the shortest path from one vertex to another
+//	Preconditions:	none
+//	Postconditions:	the vertices from source to destination are returned in
+//					order of travel, or an empty vector if there is no path, the
+//					store has no row for source or it only keeps distances
+vector<int> PathStore::path(int source, int destination) const {
+	vector<int> result;
+	if (previous == nullptr || !hasRow(source) || destination < 0 || destination >= vertices ||
+		distance(source, destination) == NO_DISTANCE) {
+		return result;
+	}
+	// walk the previous vertices back to source, then put them in travel order
+	uint64_t first = static_cast<uint64_t>(slotOf[source]) * vertices;
+	for (int vertex = destination; vertex != source; ) {
+		result.push_back(vertex);
+		vertex = static_cast<int>(readCell(previous + (first + vertex) * previousWidth, previousWidth));
+	}
+	result.push_back(source);
+	reverse(result.begin(), result.end());
+	return result;
+}
+
+
+//-------------------------------  hasPaths  -------------------------------------
+//	Returns whether the store keeps the previous vertices of its paths
+//	Preconditions:	none
+//	Postconditions:	true is returned for DISTANCES_AND_PATHS. store is not changed
+bool PathStore::hasPaths() const {
+	return previousWidth > 0;
+}
+
+
+//-------------------------------  sourceCount  ----------------------------------
+//	Returns the number of source vertices the store holds rows for
+//	Preconditions:	none
+//	Postconditions:	the number of rows is returned. store is not changed
+int PathStore::sourceCount() const {
+	return static_cast<int>(sources.size());
+}
+
+
+//-------------------------------  vertexCount  ----------------------------------
+//	Returns the number of vertices the store was sized for
+//	Preconditions:	none
+//	Postconditions:	the number of vertices is returned. store is not changed
+int PathStore::vertexCount() const {
+	return vertices;
+}
+
+
+//------------------------------  distanceBytes  ---------------------------------
+//	Returns the width of a distance cell
+//	Preconditions:	none
+//	Postconditions:	1, 2, 4 or 8 is returned, 0 for an empty store
+int PathStore::distanceBytes() const {
+	return distanceWidth;
+}
+
+
+//------------------------------  previousBytes  ---------------------------------
+//	Returns the width of a previous vertex cell
+//	Preconditions:	none
+//	Postconditions:	1, 2 or 4 is returned, 0 if the store only keeps distances
+int PathStore::previousBytes() const {
+	return previousWidth;
+}
+
+
+//--------------------------------  byteCount  -----------------------------------
+//	Returns the number of bytes the cells take up
+//	Preconditions:	none
+//	Postconditions:	the bytes of every row, in memory or in the file, are returned
+uint64_t PathStore::byteCount() const {
+	return static_cast<uint64_t>(vertices) * sources.size() * (distanceWidth + previousWidth);
+}
+
+
+//--------------------------------  cellWidth  -----------------------------------
+//	Finds the narrowest cell that holds a value
+//	Preconditions:	maxWidth is 4 or 8
+//	Postconditions:	the fewest bytes, 1, 2, 4 or up to maxWidth, in which value
+//					fits are returned
+int PathStore::cellWidth(uint64_t value, int maxWidth) {
+	if (value <= UINT8_MAX) {
+		return 1;
+	}
+	if (value <= UINT16_MAX) {
+		return 2;
+	}
+	if (value <= UINT32_MAX || maxWidth == 4) {
+		return 4;
+	}
+	return 8;
+}
+
+
+//--------------------------------  readCell  ------------------------------------
+//	Reads an unsigned value from a cell
+//	Preconditions:	cell holds width bytes. width is 1, 2, 4 or 8
+//	Postconditions:	the value in the cell is returned
+uint64_t PathStore::readCell(const char* cell, int width) {
+	// cells are not aligned to their width, so they are copied out
+	switch (width) {
+	case 1: {
+		uint8_t value;
+		memcpy(&value, cell, sizeof(value));
+		return value;
+	}
+	case 2: {
+		uint16_t value;
+		memcpy(&value, cell, sizeof(value));
+		return value;
+	}
+	case 4: {
+		uint32_t value;
+		memcpy(&value, cell, sizeof(value));
+		return value;
+	}
+	default: {
+		uint64_t value;
+		memcpy(&value, cell, sizeof(value));
+		return value;
+	}
+	}
+}
+
+
+//-------------------------------  writeCell  ------------------------------------
+//	Writes an unsigned value to a cell
+//	Preconditions:	cell holds width bytes. width is 1, 2, 4 or 8. value fits in it
+//	Postconditions:	the cell holds value
+void PathStore::writeCell(char* cell, int width, uint64_t value) {
+	switch (width) {
+	case 1: {
+		uint8_t narrow = static_cast<uint8_t>(value);
+		memcpy(cell, &narrow, sizeof(narrow));
+		break;
+	}
+	case 2: {
+		uint16_t narrow = static_cast<uint16_t>(value);
+		memcpy(cell, &narrow, sizeof(narrow));
+		break;
+	}
+	case 4: {
+		uint32_t narrow = static_cast<uint32_t>(value);
+		memcpy(cell, &narrow, sizeof(narrow));
+		break;
+	}
+	default:
+		memcpy(cell, &value, sizeof(value));
+		break;
+	}
+}
@@ -0,0 +1,197 @@
+//---------------------------------------------------------------------------------
+// PathStore.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// PathStore Class:	Holds the shortest distances, and optionally the previous
+//					vertices, from a chosen set of source vertices to every vertex,
+//					in cells only as wide as the graph needs. Used by the Graph
+//					class to keep all pairs results for graphs whose Table T would
+//					not fit in memory.
+//
+//   --	chooses the width of a distance cell, 1, 2, 4 or 8 bytes, from the
+//		longest distance a path can have, and the width of a previous vertex
+//		cell, 1, 2 or 4 bytes, from the number of vertices
+//   --	allows keeping only the distances, or the distances and the previous
+//		vertices that paths are read back from
+//   --	allows keeping the rows of only some source vertices
+//   --	keeps the cells in memory, or in a file mapped into memory so the
+//		operating system pages rows in and out of it as they are used
+//   --	allows reading the distance and the path between two vertices
+//
+// Assumptions:
+//   -- vertex subscripts are in the range 0 to vertexCount - 1
+//   -- the widest value of a distance cell stands for no path, so the longest
+//		distance is always below it
+//   -- a previous vertex of 0 stands for the source itself or no path
+//   -- the rows only hold for the edges they were computed on, the store is
+//		rebuilt when an edge changes
+//   -- a store file holds the distance rows, then the previous vertex rows, in
+//		the byte order of the machine that built it. it is scratch space and is
+//		not read back by a later run
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "Distance.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+class PathStore {
+public:
+	// what is kept for each source
+	enum Contents {
+		DISTANCES_AND_PATHS,	// distances and the previous vertex of each path
+		DISTANCES_ONLY			// distances, paths cannot be read back
+	};
+
+
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the PathStore class
+	//	Preconditions:	none
+	//	Postconditions:	an empty store with no rows and no vertices is created
+	PathStore();
+
+
+	//---------------------------------  reset  --------------------------------------
+	//	Sizes the store for a graph and a list of source vertices
+	//	Preconditions:	vertexCount is greater than 0. every source is in the range 1
+	//					to vertexCount - 1 and listed once. maxDistance is the longest
+	//					distance a shortest path can have
+	//	Postconditions:	the cell widths are chosen and one row per source is made, in
+	//					memory if fileName is empty, otherwise in fileName mapped into
+	//					memory. true is returned, or false if the file could not be
+	//					made, in which case the store is empty. every cell reads as no
+	//					path until its row is set
+	bool reset(int vertexCount, const vector<int>& sources, uint64_t maxDistance,
+		Contents contents, const string& fileName);
+
+
+	//---------------------------------  setRow  -------------------------------------
+	//	Stores the shortest paths from one source
+	//	Preconditions:	slot is in the range 0 to sourceCount() - 1. dist holds
+	//					vertexCount() entries, and so does previous if the store keeps
+	//					paths, otherwise previous is not read. dist[v] is the distance
+	//					from the source of slot to v, NO_DISTANCE if there is no path,
+	//					and previous[v] the vertex before v on that path
+	//	Postconditions:	the row of slot is replaced. rows of different slots can be
+	//					set at the same time
+	void setRow(int slot, const vector<Distance>& dist, const vector<int>& previous);
+
+
+	//---------------------------------  hasRow  -------------------------------------
+	//	Returns whether the store holds the row of a source vertex
+	//	Preconditions:	none
+	//	Postconditions:	true is returned if source is one of the sources the store
+	//					was sized for. store is not changed
+	bool hasRow(int source) const;
+
+
+	//--------------------------------  distance  ------------------------------------
+	//	Returns the shortest distance from one vertex to another
+	//	Preconditions:	hasRow(source) is true. destination is in the range 0 to
+	//					vertexCount() - 1
+	//	Postconditions:	the distance is returned, NO_DISTANCE if there is no path
+	Distance distance(int source, int destination) const;
+
+
+	//----------------------------------  path  --------------------------------------
+	//	Returns the shortest path from one vertex to another
+	//	Preconditions:	none
+	//	Postconditions:	the vertices from source to destination are returned in
+	//					order of travel, or an empty vector if there is no path, the
+	//					store has no row for source or it only keeps distances
+	vector<int> path(int source, int destination) const;
+
+
+	//-------------------------------  hasPaths  -------------------------------------
+	//	Returns whether the store keeps the previous vertices of its paths
+	//	Preconditions:	none
+	//	Postconditions:	true is returned for DISTANCES_AND_PATHS. store is not changed
+	bool hasPaths() const;
+
+
+	//-------------------------------  sourceCount  ----------------------------------
+	//	Returns the number of source vertices the store holds rows for
+	//	Preconditions:	none
+	//	Postconditions:	the number of rows is returned. store is not changed
+	int sourceCount() const;
+
+
+	//-------------------------------  vertexCount  ----------------------------------
+	//	Returns the number of vertices the store was sized for
+	//	Preconditions:	none
+	//	Postconditions:	the number of vertices is returned. store is not changed
+	int vertexCount() const;
+
+
+	//------------------------------  distanceBytes  ---------------------------------
+	//	Returns the width of a distance cell
+	//	Preconditions:	none
+	//	Postconditions:	1, 2, 4 or 8 is returned, 0 for an empty store
+	int distanceBytes() const;
+
+
+	//------------------------------  previousBytes  ---------------------------------
+	//	Returns the width of a previous vertex cell
+	//	Preconditions:	none
+	//	Postconditions:	1, 2 or 4 is returned, 0 if the store only keeps distances
+	int previousBytes() const;
+
+
+	//--------------------------------  byteCount  -----------------------------------
+	//	Returns the number of bytes the cells take up
+	//	Preconditions:	none
+	//	Postconditions:	the bytes of every row, in memory or in the file, are returned
+	uint64_t byteCount() const;
+
+private:
+	int vertices;				// number of vertices the store is sized for
+	vector<int> sources;		// source vertex of each slot
+	vector<int> slotOf;			// slot of each source vertex, -1 for no row
+	int distanceWidth;			// bytes per distance cell
+	int previousWidth;			// bytes per previous vertex cell, 0 for none
+	uint64_t noPath;			// distance cell value that stands for no path
+
+	// distances[slot * vertices + v] is the distance cell from the source of slot to
+	// v, previous the previous vertex cell, nullptr if only distances are kept
+	char* distances;
+	char* previous;
+
+	// where the cells are kept, one of the two is used
+	vector<char> memory;
+	shared_ptr<MappedFile> file;
+
+
+	//--------------------------------  cellWidth  -----------------------------------
+	//	Finds the narrowest cell that holds a value
+	//	Preconditions:	maxWidth is 4 or 8
+	//	Postconditions:	the fewest bytes, 1, 2, 4 or up to maxWidth, in which value
+	//					fits are returned
+	static int cellWidth(uint64_t value, int maxWidth);
+
+
+	//--------------------------------  readCell  ------------------------------------
+	//	Reads an unsigned value from a cell
+	//	Preconditions:	cell holds width bytes. width is 1, 2, 4 or 8
+	//	Postconditions:	the value in the cell is returned
+	static uint64_t readCell(const char* cell, int width);
+
+
+	//-------------------------------  writeCell  ------------------------------------
+	//	Writes an unsigned value to a cell
+	//	Preconditions:	cell holds width bytes. width is 1, 2, 4 or 8. value fits in it
+	//	Postconditions:	the cell holds value
+	static void writeCell(char* cell, int width, uint64_t value);
+
+
+	// not copyable, distances and previous point into storage of this object
+	PathStore(const PathStore&) = delete;
+	PathStore& operator=(const PathStore&) = delete;
+};
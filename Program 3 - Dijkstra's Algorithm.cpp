@@ -16,7 +16,6 @@
 #include <iostream>
 #include <fstream>
 #include "Graph.h"
-#include "Vertex.h"
 using namespace std;
 
 //-------------------------- main -------------------------------------------
@@ -0,0 +1,84 @@
+//---------------------------------------------------------------------------------
+// QueryWorkspace.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// SearchState Class:		The arrays one direction of a single source to
+//							destination search works in: the tentative distance,
+//							the vertex it was reached from, whether it is settled,
+//							an estimate for A*, and the frontier heap.
+// QueryWorkspace Class:	A forward and a backward SearchState that a thread keeps
+//							and reuses from one query to the next.
+//
+//   --	allows starting a new query without clearing the arrays, by moving to a
+//		new generation. an entry written in an older generation reads as unset
+//   --	grows the arrays when a query is made on a larger graph, and keeps them
+//		between queries
+//   --	empties only what the last query left in the frontier heap
+//   --	keeps the counters of the search in each direction, when they are
+//		compiled in with DIJKSTRA_STATS
+//
+// Assumptions:
+//   -- vertex subscripts are in the range 0 to the vertexCount passed to prepare
+//   -- one workspace is only used by one query at a time. each thread that runs
+//		queries keeps its own
+//   -- every stamp is cleared once each time the 32 bit generation wraps around
+//---------------------------------------------------------------------------------
+
+
+
+#include "QueryWorkspace.h"
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the SearchState class
+//	Preconditions:	none
+//	Postconditions:	an empty state with room for no vertices is created
+SearchState::SearchState() : heap(0) {
+	generation = 0;
+}
+
+
+//---------------------------------  prepare  ------------------------------------
+//	Gets the state ready for a new search
+//	Preconditions:	vertexCount is greater than or equal to 0
+//	Postconditions:	every vertex 0 to vertexCount reads as unreached, unsettled
+//					and without an estimate, and the frontier is empty. the arrays
+//					are only written if they have to grow or the generation wraps.
+//					the counters of stats are 0
+void SearchState::prepare(int vertexCount) {
+	SEARCH_STATS_ONLY(stats.clear());
+	size_t needed = static_cast<size_t>(vertexCount) + 1;
+	if (reached.size() < needed) {
+		// stamps of 0 are older than every generation
+		reached.assign(needed, 0);
+		settled.assign(needed, 0);
+		estimated.assign(needed, 0);
+		distance.resize(needed);
+		previous.resize(needed);
+		estimates.resize(needed);
+		heap = IndexedHeap(static_cast<int>(needed));
+	}
+	else {
+		// only what an early stop left behind is still in the heap
+		heap.clear();
+	}
+
+	generation++;
+	if (generation == 0) {
+		reached.assign(reached.size(), 0);
+		settled.assign(settled.size(), 0);
+		estimated.assign(estimated.size(), 0);
+		generation = 1;
+	}
+}
+
+
+//---------------------------------  prepare  ------------------------------------
+//	Gets both directions ready for a new query
+//	Preconditions:	vertexCount is greater than or equal to 0
+//	Postconditions:	forward and backward are both prepared for vertexCount
+void QueryWorkspace::prepare(int vertexCount) {
+	forward.prepare(vertexCount);
+	backward.prepare(vertexCount);
+}
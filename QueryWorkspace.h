@@ -0,0 +1,118 @@
+//---------------------------------------------------------------------------------
+// QueryWorkspace.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// SearchState Class:		The arrays one direction of a single source to
+//							destination search works in: the tentative distance,
+//							the vertex it was reached from, whether it is settled,
+//							an estimate for A*, and the frontier heap.
+// QueryWorkspace Class:	A forward and a backward SearchState that a thread keeps
+//							and reuses from one query to the next.
+//
+//   --	allows starting a new query without clearing the arrays, by moving to a
+//		new generation. an entry written in an older generation reads as unset
+//   --	grows the arrays when a query is made on a larger graph, and keeps them
+//		between queries
+//   --	empties only what the last query left in the frontier heap
+//   --	keeps the counters of the search in each direction, when they are
+//		compiled in with DIJKSTRA_STATS
+//
+// Assumptions:
+//   -- vertex subscripts are in the range 0 to the vertexCount passed to prepare
+//   -- one workspace is only used by one query at a time. each thread that runs
+//		queries keeps its own
+//   -- every stamp is cleared once each time the 32 bit generation wraps around
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "Distance.h"
+#include "IndexedHeap.h"
+#include "SearchStats.h"
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+class SearchState {
+public:
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the SearchState class
+	//	Preconditions:	none
+	//	Postconditions:	an empty state with room for no vertices is created
+	SearchState();
+
+
+	//---------------------------------  prepare  ------------------------------------
+	//	Gets the state ready for a new search
+	//	Preconditions:	vertexCount is greater than or equal to 0
+	//	Postconditions:	every vertex 0 to vertexCount reads as unreached, unsettled
+	//					and without an estimate, and the frontier is empty. the arrays
+	//					are only written if they have to grow or the generation wraps.
+	//					the counters of stats are 0
+	void prepare(int vertexCount);
+
+
+	// shortest distance found to vertex, NO_DISTANCE if it has not been reached
+	Distance dist(int vertex) const { return reached[vertex] == generation ? distance[vertex] : NO_DISTANCE; }
+
+	// vertex that vertex was reached from, only valid once it has been reached
+	int link(int vertex) const { return previous[vertex]; }
+
+	// records a shorter distance to vertex and the vertex it came from
+	void reach(int vertex, Distance dist, int from) {
+		reached[vertex] = generation;
+		distance[vertex] = dist;
+		previous[vertex] = from;
+	}
+
+	// whether vertex has been settled
+	bool isSettled(int vertex) const { return settled[vertex] == generation; }
+
+	// marks vertex as settled
+	void markSettled(int vertex) { settled[vertex] = generation; }
+
+	// whether an estimate has been stored for vertex
+	bool hasEstimate(int vertex) const { return estimated[vertex] == generation; }
+
+	// estimate stored for vertex, only valid if hasEstimate is true
+	Distance estimate(int vertex) const { return estimates[vertex]; }
+
+	// stores an estimate for vertex
+	void setEstimate(int vertex, Distance value) {
+		estimated[vertex] = generation;
+		estimates[vertex] = value;
+	}
+
+	// frontier heap of the search, empty after prepare
+	IndexedHeap& frontier() { return heap; }
+
+
+	SearchStats stats;			// what the search since prepare has done
+
+private:
+	uint32_t generation;		// stamp of the current search, never 0
+	vector<uint32_t> reached;	// generation distance[v] and previous[v] were written in
+	vector<uint32_t> settled;	// generation v was settled in
+	vector<uint32_t> estimated;	// generation estimates[v] was written in
+	vector<Distance> distance;
+	vector<int> previous;
+	vector<Distance> estimates;
+	IndexedHeap heap;
+};
+
+
+class QueryWorkspace {
+public:
+	//---------------------------------  prepare  ------------------------------------
+	//	Gets both directions ready for a new query
+	//	Preconditions:	vertexCount is greater than or equal to 0
+	//	Postconditions:	forward and backward are both prepared for vertexCount
+	void prepare(int vertexCount);
+
+
+	SearchState forward;		// search from the source along the edges
+	SearchState backward;		// search from the destination along reversed edges
+};
@@ -0,0 +1,123 @@
+//---------------------------------------------------------------------------------
+// RadixHeap.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// RadixHeap Class:	A monotone priority queue of vertex subscripts keyed by
+//					integer distances. Keys are sorted into buckets by the highest
+//					bit in which they differ from the last key removed, so a key
+//					is only moved a few times between buckets instead of being
+//					compared on every step of a binary heap. Used by the Graph
+//					class as the frontier of Dijkstra's Algorithm when the edge
+//					weights are small non-negative integers.
+//
+//   --	allows inserting a vertex with a key
+//   --	allows removing a vertex with the lowest key
+//
+// Assumptions:
+//   -- keys are never lower than the key last removed, which holds for
+//		Dijkstra's Algorithm with non-negative edge weights
+//   -- a vertex whose key is lowered is inserted again instead of moved, so the
+//		caller skips the entries it has already settled
+//   -- vertices with equal keys come out in no particular order
+//---------------------------------------------------------------------------------
+
+
+
+#include "RadixHeap.h"
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the RadixHeap class
+//	Preconditions:	none
+//	Postconditions:	an empty heap whose last removed key is 0 is created
+RadixHeap::RadixHeap() {
+	last = 0;
+	count = 0;
+}
+
+
+//--------------------------------  isEmpty  -------------------------------------
+//	Checks whether the heap has any entries in it
+//	Preconditions:	none
+//	Postconditions:	true is returned if the heap is empty, otherwise false
+bool RadixHeap::isEmpty() const {
+	return count == 0;
+}
+
+
+//----------------------------------  push  --------------------------------------
+//	Inserts a vertex into the heap with the given key
+//	Preconditions:	key is not lower than the key last removed
+//	Postconditions:	an entry for vertex with key is in the heap
+void RadixHeap::push(int vertex, Distance key) {
+	buckets[bucketOf(key)].push_back(Entry{ key, vertex });
+	count++;
+}
+
+
+//---------------------------------  popMin  -------------------------------------
+//	Removes an entry with the lowest key from the heap
+//	Preconditions:	the heap is not empty
+//	Postconditions:	the entry is removed, its vertex is returned and key holds
+//					its key
+int RadixHeap::popMin(Distance& key) {
+	if (buckets[0].empty()) {
+		// the lowest key is in the first bucket that has anything. making it the
+		// new last spreads the rest of that bucket over lower buckets
+		int first = 1;
+		while (buckets[first].empty()) {
+			first++;
+		}
+		Distance lowest = buckets[first][0].key;
+		for (const Entry& entry : buckets[first]) {
+			if (entry.key < lowest) {
+				lowest = entry.key;
+			}
+		}
+		last = lowest;
+		for (const Entry& entry : buckets[first]) {
+			buckets[bucketOf(entry.key)].push_back(entry);
+		}
+		buckets[first].clear();
+	}
+
+	Entry entry = buckets[0].back();
+	buckets[0].pop_back();
+	count--;
+	key = entry.key;
+	return entry.vertex;
+}
+
+
+//---------------------------------  clear  --------------------------------------
+//	Removes every entry from the heap
+//	Preconditions:	none
+//	Postconditions:	the heap is empty and its last removed key is 0 again. the
+//					buckets keep their memory
+void RadixHeap::clear() {
+	for (vector<Entry>& bucket : buckets) {
+		bucket.clear();
+	}
+	last = 0;
+	count = 0;
+}
+
+
+//--------------------------------  bucketOf  ------------------------------------
+//	Finds the bucket a key belongs in
+//	Preconditions:	key is not lower than last
+//	Postconditions:	0 is returned if key is last, otherwise one more than the
+//					highest bit in which key and last differ
+int RadixHeap::bucketOf(Distance key) const {
+	// halve the search for the highest set bit the way a bit scan would
+	unsigned long long differ = static_cast<unsigned long long>(key ^ last);
+	int bucket = 0;
+	for (int shift = 32; shift > 0; shift >>= 1) {
+		if (differ >> shift) {
+			differ >>= shift;
+			bucket += shift;
+		}
+	}
+	return differ == 0 ? 0 : bucket + 1;
+}
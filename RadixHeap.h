@@ -0,0 +1,95 @@
+//---------------------------------------------------------------------------------
+// RadixHeap.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// RadixHeap Class:	A monotone priority queue of vertex subscripts keyed by
+//					integer distances. Keys are sorted into buckets by the highest
+//					bit in which they differ from the last key removed, so a key
+//					is only moved a few times between buckets instead of being
+//					compared on every step of a binary heap. Used by the Graph
+//					class as the frontier of Dijkstra's Algorithm when the edge
+//					weights are small non-negative integers.
+//
+//   --	allows inserting a vertex with a key
+//   --	allows removing a vertex with the lowest key
+//   --	allows emptying the heap to start another search with the same buckets
+//
+// Assumptions:
+//   -- keys are never lower than the key last removed, which holds for
+//		Dijkstra's Algorithm with non-negative edge weights
+//   -- a vertex whose key is lowered is inserted again instead of moved, so the
+//		caller skips the entries it has already settled
+//   -- vertices with equal keys come out in no particular order
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "Distance.h"
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+class RadixHeap {
+public:
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the RadixHeap class
+	//	Preconditions:	none
+	//	Postconditions:	an empty heap whose last removed key is 0 is created
+	RadixHeap();
+
+
+	//--------------------------------  isEmpty  -------------------------------------
+	//	Checks whether the heap has any entries in it
+	//	Preconditions:	none
+	//	Postconditions:	true is returned if the heap is empty, otherwise false
+	bool isEmpty() const;
+
+
+	//----------------------------------  push  --------------------------------------
+	//	Inserts a vertex into the heap with the given key
+	//	Preconditions:	key is not lower than the key last removed
+	//	Postconditions:	an entry for vertex with key is in the heap
+	void push(int vertex, Distance key);
+
+
+	//---------------------------------  popMin  -------------------------------------
+	//	Removes an entry with the lowest key from the heap
+	//	Preconditions:	the heap is not empty
+	//	Postconditions:	the entry is removed, its vertex is returned and key holds
+	//					its key
+	int popMin(Distance& key);
+
+
+	//---------------------------------  clear  --------------------------------------
+	//	Removes every entry from the heap
+	//	Preconditions:	none
+	//	Postconditions:	the heap is empty and its last removed key is 0 again. the
+	//					buckets keep their memory
+	void clear();
+
+private:
+	// one vertex and the key it was inserted with
+	struct Entry {
+		Distance key;
+		int vertex;
+	};
+
+	// bucket 0 holds keys equal to last, bucket b the keys whose highest bit that
+	// differs from last is bit b - 1
+	static const int BUCKETS = numeric_limits<Distance>::digits + 1;
+
+	vector<Entry> buckets[BUCKETS];
+	Distance last;				// key last removed
+	size_t count;				// number of entries in all the buckets
+
+
+	//--------------------------------  bucketOf  ------------------------------------
+	//	Finds the bucket a key belongs in
+	//	Preconditions:	key is not lower than last
+	//	Postconditions:	0 is returned if key is last, otherwise one more than the
+	//					highest bit in which key and last differ
+	int bucketOf(Distance key) const;
+};
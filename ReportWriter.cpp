@@ -0,0 +1,309 @@
+//---------------------------------------------------------------------------------
+// ReportWriter.cpp
+// Author: Brent Barrese
+// Class Definitions
+//---------------------------------------------------------------------------------
+// ReportWriter Class:	Formats a shortest path report into a large buffer and
+//						writes the buffer out in big pieces, instead of one
+//						formatted stream insertion per field and a flush per line.
+//
+//   --	allows writing to any ostream, or straight to a file descriptor
+//   --	allows writing the report as the text table displayAll prints, as comma
+//		or tab separated values, or as binary records
+//   --	allows choosing the size of the buffer
+//   --	writes whatever is left in the buffer when the object is destroyed
+//
+// Assumptions:
+//   -- a report is written as beginReport, then for each source beginSource,
+//		any number of writeRow and endSource
+//   -- the text table is laid out the same way displayAll always printed it
+//   -- separated values start with a header line and hold one line per row,
+//		with the path as vertex subscripts separated by spaces, and an empty
+//		distance and path when there is no path
+//   -- binary reports start with a BinaryHeader and hold one record per row:
+//		int32 source, int32 destination, int64 distance (-1 if there is no
+//		path), int32 number of vertices in the path, then the path as int32
+//		vertex subscripts. numbers are in the byte order of the writing machine
+//   -- the object cannot be copied, it owns its buffer
+//---------------------------------------------------------------------------------
+
+
+
+#include "ReportWriter.h"
+#include <cstring>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Constructor for the ReportWriter class that writes to a stream
+//	Preconditions:	out stays open for as long as the object is used
+//	Postconditions:	a writer with an empty buffer of bufferBytes is created. the
+//					field width of out is reset to 0
+ReportWriter::ReportWriter(ostream& out, Format format, size_t bufferBytes)
+	: buffer(bufferBytes > 64 ? bufferBytes : 64) {
+	this->out = &out;
+	fileDescriptor = -1;
+	this->format = format;
+	used = 0;
+	failed = false;
+	// a width left set on the stream is used up here, as the first formatted
+	// insertion of the report would have used it
+	out.width(0);
+}
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Constructor for the ReportWriter class that writes to a file descriptor
+//	Preconditions:	fileDescriptor is open for writing for as long as the object
+//					is used. the object does not close it
+//	Postconditions:	a writer with an empty buffer of bufferBytes is created
+ReportWriter::ReportWriter(int fileDescriptor, Format format, size_t bufferBytes)
+	: buffer(bufferBytes > 64 ? bufferBytes : 64) {
+	out = nullptr;
+	this->fileDescriptor = fileDescriptor;
+	this->format = format;
+	used = 0;
+	failed = false;
+}
+
+
+//-------------------------------  destructor  -----------------------------------
+//	Destructor for the ReportWriter class
+//	Preconditions:	none
+//	Postconditions:	whatever is left in the buffer is written out
+ReportWriter::~ReportWriter() {
+	flush();
+}
+
+
+//-------------------------------  beginReport  ----------------------------------
+//	Writes what comes before the first source
+//	Preconditions:	vertexCount is the number of vertices in the graph
+//	Postconditions:	the column header, or the binary header, is buffered
+void ReportWriter::beginReport(int vertexCount) {
+	switch (format) {
+	case TEXT:
+		append("Description", 11);
+		appendPadded("From", 16);
+		appendPadded("To", 6);
+		appendPadded("Dist", 6);
+		appendPadded("Path", 6);
+		append("\n", 1);
+		break;
+	case CSV:
+		appendPadded("source,destination,distance,path\n", 0);
+		break;
+	case TSV:
+		appendPadded("source\tdestination\tdistance\tpath\n", 0);
+		break;
+	case BINARY: {
+		BinaryHeader header;
+		memcpy(header.magic, "DIJKRPRT", sizeof(header.magic));
+		header.version = BINARY_VERSION;
+		header.byteOrder = BINARY_BYTE_ORDER;
+		header.vertexCount = vertexCount;
+		header.reserved = 0;
+		append(reinterpret_cast<const char*>(&header), sizeof(header));
+		break;
+	}
+	}
+}
+
+
+//-------------------------------  beginSource  ----------------------------------
+//	Writes what comes before the rows of one source vertex
+//	Preconditions:	beginReport has been called
+//	Postconditions:	the text table has the description of source buffered. the
+//					other formats buffer nothing
+void ReportWriter::beginSource(int /* source */, string_view description) {
+	if (format == TEXT) {
+		append(description.data(), description.size());
+		append("\n", 1);
+	}
+}
+
+
+//---------------------------------  writeRow  -----------------------------------
+//	Writes the shortest path from a source vertex to a destination vertex
+//	Preconditions:	beginSource has been called for source. path holds the vertices
+//					from source to destination, or is empty if there is no path
+//	Postconditions:	one row is buffered. distance is shown as "--" in the text
+//					table, or left empty, if it is NO_DISTANCE
+void ReportWriter::writeRow(int source, int destination, Distance distance, const vector<int>& path) {
+	bool reached = distance < NO_DISTANCE;
+	if (format == BINARY) {
+		appendBinary(static_cast<int32_t>(source));
+		appendBinary(static_cast<int32_t>(destination));
+		appendBinary(static_cast<int64_t>(reached ? distance : -1));
+		appendBinary(static_cast<int32_t>(path.size()));
+		for (int vertex : path) {
+			appendBinary(static_cast<int32_t>(vertex));
+		}
+		return;
+	}
+
+	if (format == TEXT) {
+		appendInteger(source, 26);
+		appendInteger(destination, 6);
+		if (reached) {
+			appendInteger(distance, 6);
+		}
+		else {
+			appendPadded("--", 6);
+		}
+		// the first vertex of the path is padded to 4 characters, as the table
+		// has always been printed
+		for (size_t i = 0; i < path.size(); i++) {
+			append(i == 0 ? "    " : " ", i == 0 ? 4 : 1);
+			appendInteger(path[i]);
+		}
+		append("\n", 1);
+		return;
+	}
+
+	char separator = format == CSV ? ',' : '\t';
+	appendInteger(source);
+	append(&separator, 1);
+	appendInteger(destination);
+	append(&separator, 1);
+	if (reached) {
+		appendInteger(distance);
+	}
+	append(&separator, 1);
+	for (size_t i = 0; i < path.size(); i++) {
+		if (i > 0) {
+			append(" ", 1);
+		}
+		appendInteger(path[i]);
+	}
+	append("\n", 1);
+}
+
+
+//--------------------------------  endSource  -----------------------------------
+//	Writes what comes after the rows of one source vertex
+//	Preconditions:	beginSource has been called
+//	Postconditions:	the text table has a blank line buffered. the other formats
+//					buffer nothing
+void ReportWriter::endSource() {
+	if (format == TEXT) {
+		append("\n", 1);
+	}
+}
+
+
+//----------------------------------  flush  -------------------------------------
+//	Writes out everything in the buffer
+//	Preconditions:	none
+//	Postconditions:	the buffer is empty. true is returned if everything written so
+//					far has reached the stream or file descriptor, otherwise false
+bool ReportWriter::flush() {
+	if (used > 0) {
+		writeOut(buffer.data(), used);
+		used = 0;
+	}
+	return !failed;
+}
+
+
+//---------------------------------  reserve  ------------------------------------
+//	Makes room in the buffer for more bytes
+//	Preconditions:	none
+//	Postconditions:	the buffer has room for at least bytes more bytes, writing it
+//					out first if it is too full
+void ReportWriter::reserve(size_t bytes) {
+	if (buffer.size() - used < bytes) {
+		flush();
+		if (buffer.size() < bytes) {
+			buffer.resize(bytes);
+		}
+	}
+}
+
+
+//---------------------------------  append  -------------------------------------
+//	Copies bytes to the end of the buffer
+//	Preconditions:	none
+//	Postconditions:	the bytes are buffered
+void ReportWriter::append(const char* bytes, size_t count) {
+	reserve(count);
+	memcpy(buffer.data() + used, bytes, count);
+	used += count;
+}
+
+
+//------------------------------  appendInteger  ---------------------------------
+//	Formats a number in decimal at the end of the buffer
+//	Preconditions:	width is greater than or equal to 0
+//	Postconditions:	the digits are buffered, right aligned in width characters the
+//					way setw would pad them
+void ReportWriter::appendInteger(long long value, int width) {
+	// digits are made from the last one back, into the end of a scratch array
+	char digits[24];
+	char* first = digits + sizeof(digits);
+	unsigned long long magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value)
+		: static_cast<unsigned long long>(value);
+	do {
+		*--first = static_cast<char>('0' + magnitude % 10);
+		magnitude /= 10;
+	} while (magnitude > 0);
+	if (value < 0) {
+		*--first = '-';
+	}
+
+	int length = static_cast<int>(digits + sizeof(digits) - first);
+	int padding = width > length ? width - length : 0;
+	reserve(padding + length);
+	memset(buffer.data() + used, ' ', padding);
+	memcpy(buffer.data() + used + padding, first, length);
+	used += padding + length;
+}
+
+
+//------------------------------  appendPadded  ----------------------------------
+//	Copies text to the end of the buffer, right aligned
+//	Preconditions:	width is greater than or equal to 0
+//	Postconditions:	the text is buffered, right aligned in width characters the
+//					way setw would pad it
+void ReportWriter::appendPadded(const char* text, int width) {
+	int length = static_cast<int>(strlen(text));
+	int padding = width > length ? width - length : 0;
+	reserve(padding + length);
+	memset(buffer.data() + used, ' ', padding);
+	memcpy(buffer.data() + used + padding, text, length);
+	used += padding + length;
+}
+
+
+//---------------------------------  writeOut  -----------------------------------
+//	Writes bytes to the stream or file descriptor
+//	Preconditions:	none
+//	Postconditions:	the bytes are written, or failed is set
+void ReportWriter::writeOut(const char* bytes, size_t count) {
+	if (out != nullptr) {
+		if (!out->write(bytes, static_cast<streamsize>(count))) {
+			failed = true;
+		}
+		return;
+	}
+
+	// a descriptor may take fewer bytes than asked for, so keep going
+	while (count > 0) {
+#ifdef _WIN32
+		int written = _write(fileDescriptor, bytes, static_cast<unsigned int>(count));
+#else
+		ssize_t written = write(fileDescriptor, bytes, count);
+#endif
+		if (written <= 0) {
+			failed = true;
+			return;
+		}
+		bytes += written;
+		count -= static_cast<size_t>(written);
+	}
+}
@@ -0,0 +1,190 @@
+//---------------------------------------------------------------------------------
+// ReportWriter.h
+// Author: Brent Barrese
+// Class Declarations
+//---------------------------------------------------------------------------------
+// ReportWriter Class:	Formats a shortest path report into a large buffer and
+//						writes the buffer out in big pieces, instead of one
+//						formatted stream insertion per field and a flush per line.
+//
+//   --	allows writing to any ostream, or straight to a file descriptor
+//   --	allows writing the report as the text table displayAll prints, as comma
+//		or tab separated values, or as binary records
+//   --	allows choosing the size of the buffer
+//   --	writes whatever is left in the buffer when the object is destroyed
+//
+// Assumptions:
+//   -- a report is written as beginReport, then for each source beginSource,
+//		any number of writeRow and endSource
+//   -- the text table is laid out the same way displayAll always printed it
+//   -- separated values start with a header line and hold one line per row,
+//		with the path as vertex subscripts separated by spaces, and an empty
+//		distance and path when there is no path
+//   -- binary reports start with a BinaryHeader and hold one record per row:
+//		int32 source, int32 destination, int64 distance (-1 if there is no
+//		path), int32 number of vertices in the path, then the path as int32
+//		vertex subscripts. numbers are in the byte order of the writing machine
+//   -- the object cannot be copied, it owns its buffer
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "Distance.h"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace std;
+
+class ReportWriter {
+public:
+	// layouts a report can be written in
+	enum Format {
+		TEXT,					// aligned table, as displayAll prints it
+		CSV,					// comma separated values
+		TSV,					// tab separated values
+		BINARY					// fixed size binary records
+	};
+
+	static const size_t DEFAULT_BUFFER_BYTES = 1 << 20;
+
+
+	//-------------------------------  constructor  ----------------------------------
+	//	Constructor for the ReportWriter class that writes to a stream
+	//	Preconditions:	out stays open for as long as the object is used
+	//	Postconditions:	a writer with an empty buffer of bufferBytes is created. the
+	//					field width of out is reset to 0
+	ReportWriter(ostream& out, Format format = TEXT, size_t bufferBytes = DEFAULT_BUFFER_BYTES);
+
+
+	//-------------------------------  constructor  ----------------------------------
+	//	Constructor for the ReportWriter class that writes to a file descriptor
+	//	Preconditions:	fileDescriptor is open for writing for as long as the object
+	//					is used. the object does not close it
+	//	Postconditions:	a writer with an empty buffer of bufferBytes is created
+	ReportWriter(int fileDescriptor, Format format = TEXT, size_t bufferBytes = DEFAULT_BUFFER_BYTES);
+
+
+	//-------------------------------  destructor  -----------------------------------
+	//	Destructor for the ReportWriter class
+	//	Preconditions:	none
+	//	Postconditions:	whatever is left in the buffer is written out
+	~ReportWriter();
+
+
+	//-------------------------------  beginReport  ----------------------------------
+	//	Writes what comes before the first source
+	//	Preconditions:	vertexCount is the number of vertices in the graph
+	//	Postconditions:	the column header, or the binary header, is buffered
+	void beginReport(int vertexCount);
+
+
+	//-------------------------------  beginSource  ----------------------------------
+	//	Writes what comes before the rows of one source vertex
+	//	Preconditions:	beginReport has been called
+	//	Postconditions:	the text table has the description of source buffered. the
+	//					other formats buffer nothing
+	void beginSource(int source, string_view description);
+
+
+	//---------------------------------  writeRow  -----------------------------------
+	//	Writes the shortest path from a source vertex to a destination vertex
+	//	Preconditions:	beginSource has been called for source. path holds the vertices
+	//					from source to destination, or is empty if there is no path
+	//	Postconditions:	one row is buffered. distance is shown as "--" in the text
+	//					table, or left empty, if it is NO_DISTANCE
+	void writeRow(int source, int destination, Distance distance, const vector<int>& path);
+
+
+	//--------------------------------  endSource  -----------------------------------
+	//	Writes what comes after the rows of one source vertex
+	//	Preconditions:	beginSource has been called
+	//	Postconditions:	the text table has a blank line buffered. the other formats
+	//					buffer nothing
+	void endSource();
+
+
+	//----------------------------------  flush  -------------------------------------
+	//	Writes out everything in the buffer
+	//	Preconditions:	none
+	//	Postconditions:	the buffer is empty. true is returned if everything written so
+	//					far has reached the stream or file descriptor, otherwise false
+	bool flush();
+
+private:
+	// first bytes of a binary report
+	struct BinaryHeader {
+		char magic[8];			// "DIJKRPRT"
+		uint32_t version;		// BINARY_VERSION
+		uint32_t byteOrder;		// BINARY_BYTE_ORDER as written by the writing machine
+		int32_t vertexCount;	// number of vertices in the graph
+		int32_t reserved;		// 0, keeps the header a multiple of 8 bytes
+	};
+
+	static const uint32_t BINARY_VERSION = 1;
+	static const uint32_t BINARY_BYTE_ORDER = 0x01020304;
+
+	ostream* out;				// stream written to, nullptr when writing to a descriptor
+	int fileDescriptor;			// descriptor written to, -1 when writing to a stream
+	Format format;
+	vector<char> buffer;		// formatted bytes waiting to be written
+	size_t used;				// bytes of buffer in use
+	bool failed;				// a write to the stream or descriptor has failed
+
+
+	//---------------------------------  reserve  ------------------------------------
+	//	Makes room in the buffer for more bytes
+	//	Preconditions:	none
+	//	Postconditions:	the buffer has room for at least bytes more bytes, writing it
+	//					out first if it is too full
+	void reserve(size_t bytes);
+
+
+	//---------------------------------  append  -------------------------------------
+	//	Copies bytes to the end of the buffer
+	//	Preconditions:	none
+	//	Postconditions:	the bytes are buffered
+	void append(const char* bytes, size_t count);
+
+
+	//------------------------------  appendInteger  ---------------------------------
+	//	Formats a number in decimal at the end of the buffer
+	//	Preconditions:	width is greater than or equal to 0
+	//	Postconditions:	the digits are buffered, right aligned in width characters the
+	//					way setw would pad them
+	void appendInteger(long long value, int width = 0);
+
+
+	//------------------------------  appendPadded  ----------------------------------
+	//	Copies text to the end of the buffer, right aligned
+	//	Preconditions:	width is greater than or equal to 0
+	//	Postconditions:	the text is buffered, right aligned in width characters the
+	//					way setw would pad it
+	void appendPadded(const char* text, int width);
+
+
+	//-------------------------------  appendBinary  ---------------------------------
+	//	Copies the bytes of a number to the end of the buffer
+	//	Preconditions:	none
+	//	Postconditions:	the bytes of value are buffered in the byte order of the machine
+	template <class Number>
+	void appendBinary(Number value) {
+		append(reinterpret_cast<const char*>(&value), sizeof(value));
+	}
+
+
+	//---------------------------------  writeOut  -----------------------------------
+	//	Writes bytes to the stream or file descriptor
+	//	Preconditions:	none
+	//	Postconditions:	the bytes are written, or failed is set
+	void writeOut(const char* bytes, size_t count);
+
+
+	// not copyable, the buffer belongs to one object
+	ReportWriter(const ReportWriter&) = delete;
+	ReportWriter& operator=(const ReportWriter&) = delete;
+};
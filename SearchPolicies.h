@@ -0,0 +1,297 @@
+//---------------------------------------------------------------------------------
+// SearchPolicies.h
+// Author: Brent Barrese
+// Class Declarations and Definitions
+//---------------------------------------------------------------------------------
+// CompactAdjacency Class:	A copy of a CSRGraph with the adjacent vertices stored
+//							as Index and the weights as Weight, so the edges of a
+//							small graph take a fraction of the cache.
+// HeapQueue Class:			Frontier policy that keeps each vertex once in an
+//							indexed binary heap of Index subscripts and lowers its
+//							key when a shorter path is found.
+// RadixQueue Class:		Frontier policy that pushes a vertex again on a radix
+//							heap when a shorter path is found, leaving the old
+//							entry behind to be skipped.
+//
+//   --	lets the Dijkstra core of the Graph class be compiled once per storage
+//		and frontier, with the index and weight widths and the way a shorter
+//		path is recorded fixed at compile time. CSRGraph itself is the storage
+//		for graphs that do not fit the narrow types
+//   --	allows checking whether a CSRGraph fits the narrow types before it is
+//		copied
+//   --	remembers which CSRGraph a compact copy was made from
+//
+// Assumptions:
+//   -- a storage policy has rowBegin, rowEnd, adjVertexAt and weightAt, as
+//		CSRGraph does
+//   -- a frontier policy has isEmpty, push, lower, popMin and clear, and HOLDS_STALE
+//		is true if popMin can return an entry for a vertex that was already
+//		settled or reached again since
+//   -- every vertex subscript and weight of a compact copy fits Index and Weight
+//   -- being templates, the definitions are in this header
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include "CSRGraph.h"
+#include "Distance.h"
+#include "IndexedHeap.h"
+#include "RadixHeap.h"
+#include "SearchStats.h"
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+template <typename Index, typename Weight>
+class CompactAdjacency {
+public:
+	//---------------------------------  fits  ---------------------------------------
+	//	Checks whether a CSRGraph can be copied into the narrow types
+	//	Preconditions:	none
+	//	Postconditions:	true is returned if every row subscript is less than the
+	//					largest value of Index and every weight is between 0 and the
+	//					largest value of Weight, otherwise false
+	static bool fits(const CSRGraph& edges);
+
+
+	//---------------------------------  build  --------------------------------------
+	//	Copies a CSRGraph into the narrow types
+	//	Preconditions:	fits(edges) is true
+	//	Postconditions:	this object holds the same rows as edges, and builtFrom(edges)
+	//					is true until edges is rebuilt
+	void build(const CSRGraph& edges);
+
+
+	//-------------------------------  builtFrom  ------------------------------------
+	//	Checks whether this object is a copy of the current rows of a CSRGraph
+	//	Preconditions:	none
+	//	Postconditions:	true is returned if build was last called with edges and
+	//					edges has not been rebuilt since
+	bool builtFrom(const CSRGraph& edges) const;
+
+
+	//---------------------------------  clear  --------------------------------------
+	//	Removes every row and edge
+	//	Preconditions:	none
+	//	Postconditions:	the object is empty and owns no memory
+	void clear();
+
+
+	// subscript of the first edge leaving vertex
+	int rowBegin(int vertex) const { return offsets[vertex]; }
+
+	// one past the subscript of the last edge leaving vertex
+	int rowEnd(int vertex) const { return offsets[vertex + 1]; }
+
+	// vertex that an edge points to
+	Index adjVertexAt(int edge) const { return adjVertex[edge]; }
+
+	// weight of an edge
+	Weight weightAt(int edge) const { return weight[edge]; }
+
+private:
+	vector<int> offsets;		// offsets[v] is the first edge of row v
+	vector<Index> adjVertex;	// subscript of the adjacent vertex of each edge
+	vector<Weight> weight;		// weight of each edge
+
+	// shares the arrays of the rows this was copied from, so they cannot be freed
+	// and their address taken by new rows while this copy is compared to them
+	CSRGraph source;
+};
+
+
+template <typename Index>
+class HeapQueue {
+public:
+	// each vertex is in the heap once, nothing it returns has to be skipped
+	static const bool HOLDS_STALE = false;
+
+	// an empty frontier for the vertex subscripts 0 to capacity - 1
+	explicit HeapQueue(int capacity) : heap(capacity) {}
+
+	// whether nothing is left on the frontier
+	bool isEmpty() const { return heap.isEmpty(); }
+
+	// puts a vertex that is not on the frontier on it
+	void push(Index vertex, Distance key) { heap.push(vertex, key); }
+
+	// takes every vertex off the frontier, keeping its memory for the next search
+	void clear() { heap.clear(); }
+
+
+	//---------------------------------  lower  --------------------------------------
+	//	Records a shorter distance to a vertex that is not settled
+	//	Preconditions:	key is less than any key vertex has on the frontier
+	//	Postconditions:	vertex is on the frontier with key, its key lowered if it was
+	//					on it already. the push or the decrease is counted in stats
+	void lower(Index vertex, Distance key, SearchStats& stats);
+
+
+	//---------------------------------  popMin  -------------------------------------
+	//	Removes the vertex with the lowest key from the frontier
+	//	Preconditions:	the frontier is not empty
+	//	Postconditions:	the vertex is removed and returned, and key holds its key
+	Index popMin(Distance& key);
+
+private:
+	BasicIndexedHeap<Index> heap;
+};
+
+
+template <typename Index>
+class RadixQueue {
+public:
+	// a vertex reached again leaves its older entry behind
+	static const bool HOLDS_STALE = true;
+
+	// an empty frontier, capacity is not needed by a radix heap
+	explicit RadixQueue(int) {}
+
+	// whether nothing is left on the frontier
+	bool isEmpty() const { return heap.isEmpty(); }
+
+	// puts an entry for vertex on the frontier
+	void push(Index vertex, Distance key) { heap.push(vertex, key); }
+
+	// takes every entry off the frontier, so the next search can start again at 0
+	void clear() { heap.clear(); }
+
+
+	//---------------------------------  lower  --------------------------------------
+	//	Records a shorter distance to a vertex that is not settled
+	//	Preconditions:	key is not lower than the key last removed
+	//	Postconditions:	a new entry for vertex with key is on the frontier, and the
+	//					push is counted in stats
+	void lower(Index vertex, Distance key, SearchStats& stats);
+
+
+	//---------------------------------  popMin  -------------------------------------
+	//	Removes an entry with the lowest key from the frontier
+	//	Preconditions:	the frontier is not empty
+	//	Postconditions:	the entry is removed, its vertex is returned and key holds
+	//					its key
+	Index popMin(Distance& key);
+
+private:
+	RadixHeap heap;
+};
+
+
+//---------------------------------  fits  ---------------------------------------
+//	Checks whether a CSRGraph can be copied into the narrow types
+//	Preconditions:	none
+//	Postconditions:	true is returned if every row subscript is less than the
+//					largest value of Index and every weight is between 0 and the
+//					largest value of Weight, otherwise false
+template <typename Index, typename Weight>
+bool CompactAdjacency<Index, Weight>::fits(const CSRGraph& edges) {
+	// the largest Index is kept out of the rows, BasicIndexedHeap uses it as a mark
+	if (static_cast<long long>(edges.rowCount()) > numeric_limits<Index>::max()) {
+		return false;
+	}
+	const int* weights = edges.weightArray();
+	for (int edge = 0; edge < edges.edgeCount(); edge++) {
+		if (weights[edge] < 0 || static_cast<long long>(weights[edge]) > numeric_limits<Weight>::max()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+//---------------------------------  build  --------------------------------------
+//	Copies a CSRGraph into the narrow types
+//	Preconditions:	fits(edges) is true
+//	Postconditions:	this object holds the same rows as edges, and builtFrom(edges)
+//					is true until edges is rebuilt
+template <typename Index, typename Weight>
+void CompactAdjacency<Index, Weight>::build(const CSRGraph& edges) {
+	int edgeCount = edges.edgeCount();
+	offsets.assign(edges.offsetArray(), edges.offsetArray() + edges.rowCount() + 1);
+	adjVertex.resize(edgeCount);
+	weight.resize(edgeCount);
+	for (int edge = 0; edge < edgeCount; edge++) {
+		adjVertex[edge] = static_cast<Index>(edges.adjVertexAt(edge));
+		weight[edge] = static_cast<Weight>(edges.weightAt(edge));
+	}
+	source = edges;
+}
+
+
+//-------------------------------  builtFrom  ------------------------------------
+//	Checks whether this object is a copy of the current rows of a CSRGraph
+//	Preconditions:	none
+//	Postconditions:	true is returned if build was last called with edges and
+//					edges has not been rebuilt since
+template <typename Index, typename Weight>
+bool CompactAdjacency<Index, Weight>::builtFrom(const CSRGraph& edges) const {
+	return !offsets.empty() && source.offsetArray() == edges.offsetArray() &&
+		source.adjVertexArray() == edges.adjVertexArray() && source.rowCount() == edges.rowCount();
+}
+
+
+//---------------------------------  clear  --------------------------------------
+//	Removes every row and edge
+//	Preconditions:	none
+//	Postconditions:	the object is empty and owns no memory
+template <typename Index, typename Weight>
+void CompactAdjacency<Index, Weight>::clear() {
+	vector<int>().swap(offsets);
+	vector<Index>().swap(adjVertex);
+	vector<Weight>().swap(weight);
+	source.clear();
+}
+
+
+//---------------------------------  lower  --------------------------------------
+//	Records a shorter distance to a vertex that is not settled
+//	Preconditions:	key is less than any key vertex has on the frontier
+//	Postconditions:	vertex is on the frontier with key, its key lowered if it was
+//					on it already. the push or the decrease is counted in stats
+template <typename Index>
+void HeapQueue<Index>::lower(Index vertex, Distance key, SearchStats& stats) {
+	if (heap.contains(vertex)) {
+		heap.decreaseKey(vertex, key);
+		SEARCH_COUNT(stats, heapDecreases, 1);
+	}
+	else {
+		heap.push(vertex, key);
+		SEARCH_COUNT(stats, heapPushes, 1);
+	}
+}
+
+
+//---------------------------------  popMin  -------------------------------------
+//	Removes the vertex with the lowest key from the frontier
+//	Preconditions:	the frontier is not empty
+//	Postconditions:	the vertex is removed and returned, and key holds its key
+template <typename Index>
+Index HeapQueue<Index>::popMin(Distance& key) {
+	key = heap.minKey();
+	return heap.popMin();
+}
+
+
+//---------------------------------  lower  --------------------------------------
+//	Records a shorter distance to a vertex that is not settled
+//	Preconditions:	key is not lower than the key last removed
+//	Postconditions:	a new entry for vertex with key is on the frontier, and the
+//					push is counted in stats
+template <typename Index>
+void RadixQueue<Index>::lower(Index vertex, Distance key, SearchStats& stats) {
+	heap.push(vertex, key);
+	SEARCH_COUNT(stats, heapPushes, 1);
+}
+
+
+//---------------------------------  popMin  -------------------------------------
+//	Removes an entry with the lowest key from the frontier
+//	Preconditions:	the frontier is not empty
+//	Postconditions:	the entry is removed, its vertex is returned and key holds
+//					its key
+template <typename Index>
+Index RadixQueue<Index>::popMin(Distance& key) {
+	return static_cast<Index>(heap.popMin(key));
+}
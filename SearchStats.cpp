@@ -0,0 +1,83 @@
+//---------------------------------------------------------------------------------
+// SearchStats.cpp
+// Author: Brent Barrese
+// Type Definitions
+//---------------------------------------------------------------------------------
+// SearchStats:	Counters and phase times of the shortest path searches, for
+//				finding out where the time of a slow query goes.
+// QueryTrace:	What one search did, handed to the trace callback of a Graph
+//				after each table row or single query.
+//
+//   --	counts the vertices settled, the edges scanned and relaxed, the pushes
+//		and decreases of the frontier heap, and the row entries the scanning
+//		strategies read to pick the next vertex
+//   --	times the setup, search and path tracing phases of a search
+//   --	is compiled in only when DIJKSTRA_STATS is defined. otherwise the
+//		SEARCH_ macros expand to nothing that runs, the counters stay 0 and no
+//		trace is ever made
+//
+// Assumptions:
+//   -- every file of the program is compiled with the same setting of
+//		DIJKSTRA_STATS
+//   -- one SearchStats is only written by one thread at a time
+//---------------------------------------------------------------------------------
+
+
+
+#include "SearchStats.h"
+#include <chrono>
+
+
+//-------------------------------  constructor  ----------------------------------
+//	Default constructor for the SearchStats struct
+//	Preconditions:	none
+//	Postconditions:	every counter and time is 0
+SearchStats::SearchStats() {
+	clear();
+}
+
+
+//----------------------------------  clear  -------------------------------------
+//	Sets every counter and time back to 0
+//	Preconditions:	none
+//	Postconditions:	every counter and time is 0
+void SearchStats::clear() {
+	settled = 0;
+	edgesScanned = 0;
+	relaxed = 0;
+	heapPushes = 0;
+	heapDecreases = 0;
+	scanned = 0;
+	setupNanoseconds = 0;
+	searchNanoseconds = 0;
+	traceNanoseconds = 0;
+}
+
+
+//-------------------------------  operator +=  ----------------------------------
+//	Adds the counters and times of other to these
+//	Preconditions:	none
+//	Postconditions:	each counter and time holds its sum with the one in other
+SearchStats& SearchStats::operator+=(const SearchStats& other) {
+	settled += other.settled;
+	edgesScanned += other.edgesScanned;
+	relaxed += other.relaxed;
+	heapPushes += other.heapPushes;
+	heapDecreases += other.heapDecreases;
+	scanned += other.scanned;
+	setupNanoseconds += other.setupNanoseconds;
+	searchNanoseconds += other.searchNanoseconds;
+	traceNanoseconds += other.traceNanoseconds;
+	return *this;
+}
+
+
+//--------------------------------  searchClock  -----------------------------------
+//	Reads the clock the phases are timed with
+//	Preconditions:	none
+//	Postconditions:	a count of nanoseconds from a fixed start is returned, which
+//					never goes backward
+int64_t searchClock() {
+	return chrono::duration_cast<chrono::nanoseconds>(
+		chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,107 @@
+//---------------------------------------------------------------------------------
+// SearchStats.h
+// Author: Brent Barrese
+// Type Declarations
+//---------------------------------------------------------------------------------
+// SearchStats:	Counters and phase times of the shortest path searches, for
+//				finding out where the time of a slow query goes.
+// QueryTrace:	What one search did, handed to the trace callback of a Graph
+//				after each table row or single query.
+//
+//   --	counts the vertices settled, the edges scanned and relaxed, the pushes
+//		and decreases of the frontier heap, and the row entries the scanning
+//		strategies read to pick the next vertex
+//   --	times the setup, search and path tracing phases of a search
+//   --	is compiled in only when DIJKSTRA_STATS is defined. otherwise the
+//		SEARCH_ macros expand to nothing that runs, the counters stay 0 and no
+//		trace is ever made
+//
+// Assumptions:
+//   -- every file of the program is compiled with the same setting of
+//		DIJKSTRA_STATS
+//   -- one SearchStats is only written by one thread at a time
+//---------------------------------------------------------------------------------
+
+
+
+#pragma once
+#include <cstdint>
+
+using namespace std;
+
+#ifdef DIJKSTRA_STATS
+// adds amount to one counter of stats
+#define SEARCH_COUNT(stats, counter, amount) ((stats).counter += (amount))
+// starts timing a phase, under the name given
+#define SEARCH_CLOCK(name) const int64_t name = searchClock()
+// adds the time since the clock name was started to one phase of stats
+#define SEARCH_PHASE(stats, phase, name) ((stats).phase += searchClock() - (name))
+// code that only runs when the counters are compiled in
+#define SEARCH_STATS_ONLY(code) code
+#else
+#define SEARCH_COUNT(stats, counter, amount) ((void)sizeof((stats).counter))
+#define SEARCH_CLOCK(name)
+#define SEARCH_PHASE(stats, phase, name) ((void)sizeof((stats).phase))
+#define SEARCH_STATS_ONLY(code)
+#endif
+
+
+struct SearchStats {
+	uint64_t settled;			// vertices settled, or taken off the frontier by A*
+	uint64_t edgesScanned;		// edges read out of settled vertices
+	uint64_t relaxed;			// edges that gave a vertex a shorter distance
+	uint64_t heapPushes;		// entries pushed on the frontier
+	uint64_t heapDecreases;		// keys lowered in the frontier
+	uint64_t scanned;			// row entries read by a scan for the next vertex
+	int64_t setupNanoseconds;	// getting the row, workspace and adjacency ready
+	int64_t searchNanoseconds;	// settling vertices
+	int64_t traceNanoseconds;	// building the path from the previous vertices
+
+
+	//-------------------------------  constructor  ----------------------------------
+	//	Default constructor for the SearchStats struct
+	//	Preconditions:	none
+	//	Postconditions:	every counter and time is 0
+	SearchStats();
+
+
+	//----------------------------------  clear  -------------------------------------
+	//	Sets every counter and time back to 0
+	//	Preconditions:	none
+	//	Postconditions:	every counter and time is 0
+	void clear();
+
+
+	//-------------------------------  operator +=  ----------------------------------
+	//	Adds the counters and times of other to these
+	//	Preconditions:	none
+	//	Postconditions:	each counter and time holds its sum with the one in other
+	SearchStats& operator+=(const SearchStats& other);
+};
+
+
+// the kinds of search a QueryTrace can describe
+enum SearchKind {
+	TABLE_ROW,					// a row of Table T, every path from source
+	UNIDIRECTIONAL_QUERY,		// one search from source to destination
+	BIDIRECTIONAL_QUERY,		// searches from both ends that meet
+	A_STAR_QUERY,				// a search guided by a heuristic
+	MULTI_SOURCE_QUERY			// one search started from several sources
+};
+
+
+// what one search did
+struct QueryTrace {
+	SearchKind kind;			// which search was run
+	int source;					// subscript of the source vertex
+	int destination;			// subscript of the destination vertex, 0 for a table row
+	SearchStats stats;			// counters and times of this search alone
+};
+
+
+//--------------------------------  searchClock  -----------------------------------
+//	Reads the clock the phases are timed with
+//	Preconditions:	none
+//	Postconditions:	a count of nanoseconds from a fixed start is returned, which
+//					never goes backward
+int64_t searchClock();